@@ -16,21 +16,39 @@
 
 #include "adc.h"
 #include "common.h"
-#include  <bsp_glcd.h>
+#include "sysclock.h"
+#include "idle.h"
+#include "trace.h"
+#include "mempool.h"
+#include "diag.h"
+#include "intvect.h"
 
 
 // Message Queue for ISR->Task Communication
 static OS_Q  g_adc_q;
 
+// Samples travel by pointer; the receiver owns them until released.
+static mempool_t  g_adc_pool;
+
+#define ADC_Q_SIZE          2
+
+// At most every queue entry, the sample the task is working on and the one
+// the ISR is filling are out at once. 16 bytes each out of the 20 KB heap.
+#define ADC_POOL_BLKS       (ADC_Q_SIZE + 2)
+
 
 #define ADC_SOURCE_VR1      2
 
+#define VECT_S12AD_S12ADI0  102
+
+// The kernel-aware wrapper in adcisr.s, which calls adc_isr().
+void AdcIsr(void);
+
 #define ADC_INTERRUPT_AFTER_SCAN    0x10
 #define ADC_START                   0x80
 
 #define BIT(n)              (1 << (n))
 
-
 // NOTE: Refer to p. 1,698 to 1,727  of Processor_UsersManual_Hardware.pdf
 typedef struct
 {
@@ -66,8 +84,10 @@ adc_init (void)
     OS_ERR err;
     
     /* create our reply queue */
-    OSQCreate(&g_adc_q, "ADC Queue", 1, &err);
+    OSQCreate(&g_adc_q, "ADC Queue", ADC_Q_SIZE, &err);
     assert(OS_ERR_NONE == err);
+
+    mempool_create(&g_adc_pool, "ADC Samples", sizeof(adc_sample_t), ADC_POOL_BLKS);
     
     /* Protection off */
     SYSTEM.PRCR.WORD = 0xA503u;            
@@ -85,6 +105,8 @@ adc_init (void)
        as an I/O for peripheral functions */
     PORT4.PMR.BYTE = 0x01;
 
+    intvect_register(VECT_S12AD_S12ADI0, AdcIsr);
+
     // Enable A/D interrupts at an appropriate priority, as instructed.
     uint8_t * p_IER = (uint8_t *)0x0008720C;
     uint8_t * p_IPR = (uint8_t *)0x00087366;
@@ -97,19 +119,34 @@ adc_init (void)
     adc.channel_select0 = BIT(ADC_SOURCE_VR1);
 }
 
-uint16_t
-adc_read() {
-    OS_ERR err;
-    OS_MSG_SIZE  msg_size;
-    
-    // Trigger ADC conversion.
+/*!
+* @brief Start converting VR1; the result is posted to adc_queue().
+*/
+void
+adc_start (void)
+{
+    diag_adc_start();
     adc.control |= ADC_START;
-    
-    uint16_t * p_sample = (uint16_t *)
-                          OSQPend(&g_adc_q, 0, OS_OPT_PEND_BLOCKING, &msg_size, NULL, &err);
-    assert(OS_ERR_NONE == err);
-    
-    return *p_sample;
+}
+
+/*!
+* @brief The queue that receives an adc_sample_t pointer per conversion.
+* @note  For callers that pend on several objects at once.
+*/
+OS_Q *
+adc_queue (void)
+{
+    return &g_adc_q;
+}
+
+/*!
+* @brief Return a sample taken from adc_queue().
+* @param[in] p_sample The sample.
+*/
+void
+adc_release (adc_sample_t * p_sample)
+{
+    mempool_put(&g_adc_pool, p_sample);
 }
 
 /*!
@@ -119,14 +156,34 @@ adc_read() {
 void
 adc_isr (void)
 {
-    static uint16_t	 sample;    // NOTE: Not on the stack; so address is valid.
-    OS_ERR	         err;
-
-
-    // Read from the A/D converter and reduce the range from 12-bit to 10-bit.
-    sample = adc.data[ADC_SOURCE_VR1] >> 2;
-	
-    // Send the address of the sample via a message queue.
-    OSQPost(&g_adc_q, (void *)&sample, sizeof(sample), OS_OPT_POST_FIFO, &err);	
-    assert(OS_ERR_NONE == err || OS_ERR_Q_MAX == err);
+    adc_sample_t * p_sample;
+    OS_ERR	       err;
+
+
+    diag_adc_entry();
+    idle_wake_note(IDLE_WAKE_ADC);
+    TRACE_ISR_ENTER(VECT_S12AD_S12ADI0);
+    INTVECT_ENTER(VECT_S12AD_S12ADI0);
+
+    // Each sample gets its own block, so one still being used by the task
+    // is never overwritten. If none is free the sample is dropped.
+    p_sample = (adc_sample_t *)mempool_get(&g_adc_pool);
+    if (0 != p_sample)
+    {
+        // Read from the A/D converter and reduce the range from 12-bit to 10-bit.
+        p_sample->value = adc.data[ADC_SOURCE_VR1] >> 2;
+        p_sample->time_us = sysclock_us();
+
+        // Send the address of the sample via a message queue.
+        OSQPost(&g_adc_q, (void *)p_sample, sizeof(*p_sample), OS_OPT_POST_FIFO, &err);
+        TRACE_Q_POST(&g_adc_q, err);
+        if (OS_ERR_NONE != err)
+        {
+            assert(OS_ERR_Q_MAX == err);
+            adc_release(p_sample);
+        }
+    }
+
+    INTVECT_EXIT(VECT_S12AD_S12ADI0);
+    TRACE_ISR_EXIT(VECT_S12AD_S12ADI0);
 }
@@ -9,7 +9,15 @@
 #ifndef _ADC_H
 #define _ADC_H
 
+#include <stdint.h>
+
+#include "os.h"
+
+#include "adc_sample.h"
+
 void adc_init (void);
-uint16_t adc_read();
+void adc_start(void);
+OS_Q * adc_queue(void);
+void adc_release(adc_sample_t * p_sample);
 
 #endif /* _ADC_H */
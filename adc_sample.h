@@ -0,0 +1,21 @@
+/** \file adc_sample.h
+*
+* @brief One ADC conversion result, as handed from the ISR to the task.
+*
+* @par
+* COPYRIGHT NOTICE: (C) 2014 Barr Group, LLC.
+* All rights reserved.
+*/
+
+#ifndef _ADC_SAMPLE_H
+#define _ADC_SAMPLE_H
+
+#include <stdint.h>
+
+typedef struct
+{
+    uint16_t  value;
+    uint64_t  time_us;          // When the conversion completed.
+} adc_sample_t;
+
+#endif /* _ADC_SAMPLE_H */
@@ -15,9 +15,19 @@
 #include "iorx63n.h"
 
 #include "alarm.h"
+#include "sysclock.h"
+#include "ledpattern.h"
+#include "tasks.h"
+#include "trace.h"
 
 // Global Definition
-OS_FLAG_GRP g_alarm_flags;
+bus_topic_t g_alarm_topic;
+
+// Shows the alarm being sounded, for when it cannot be heard.
+#define ALARM_LED   5
+
+// When the alarm being sounded last changed.
+static uint64_t g_alarm_changed_us;
 
 
 // PWM Prescalars
@@ -38,12 +48,7 @@ const wave_t   alarm_medium = { TONE_MED, TONE_HI,  1, 0};
 const wave_t   alarm_high   = { TONE_LO,  TONE_HI,  1, 1};
 
 
-// Speaker Task Items
-#define SPEAKER_PRIO        11    // WARNING: Hard coded here; not using main.
-#define TASK_STACK_SIZE     128
-
-static CPU_STK g_speaker_stack[TASK_STACK_SIZE];
-static OS_TCB  g_speaker_tcb;
+// The speaker task's priority and stack are in tasks.h.
 
 /*!
 *
@@ -146,6 +151,16 @@ speaker_task (void * p_arg)
 }
 
 
+/*!
+* @brief Time at which the alarm being sounded last changed.
+* @return Microseconds, from the system clock.
+*/
+uint64_t
+alarm_changed_us (void)
+{
+    return g_alarm_changed_us;
+}
+
 /*!
 *
 * @brief Alarm Task
@@ -154,6 +169,7 @@ void
 alarm_task (void * p_arg)
 {
     wave_t const *  p_waveform = (wave_t *) NULL;
+    wave_t const *  p_previous;
     uint8_t         b_speaker_task_alive = 0;
     uint8_t         b_create_speaker_task;
     OS_ERR		    err;		
@@ -164,20 +180,25 @@ alarm_task (void * p_arg)
     // Configure the speaker hardware.
     speaker_config();
 
+    // Alarm updates arrive in this task's own message queue.
+    bus_subscribe(&g_alarm_topic);
+
     for (;;)	
     {
         // TODO: Do nothing until there is a signal from another task.
 		
         // Assume for now there's no new task creation to do.
         b_create_speaker_task = 0;
+        p_previous = p_waveform;
         
-        OS_FLAGS flags = OSFlagPend(&g_alarm_flags,
-                                    ALARM_HIGH|ALARM_MEDIUM|ALARM_LOW|ALARM_NONE,
-                                    0,
-                                    OS_OPT_PEND_FLAG_SET_ANY|OS_OPT_PEND_FLAG_CONSUME|OS_OPT_PEND_BLOCKING,
-                                    0,
-                                    &err);
+        OS_MSG_SIZE   msg_size;
+        alarm_msg_t * p_msg = (alarm_msg_t *)OSTaskQPend(0, OS_OPT_PEND_BLOCKING, &msg_size, 0, &err);
+        TRACE_Q_PEND(&g_alarm_topic, err);
         assert(OS_ERR_NONE == err);
+
+        uint8_t flags = p_msg->alarms;
+        bus_release(p_msg);
+
         // Ensure the proper alarm is playing.
         if (ALARM_HIGH&flags)
         {
@@ -188,7 +209,7 @@ alarm_task (void * p_arg)
 		if (b_speaker_task_alive)
                 {
                     // Kill the speaker task.
-		    OSTaskDel(&g_speaker_tcb, &err);	
+		    OSTaskDel(task_tcb(TASK_SPEAKER), &err);	
                     assert(OS_ERR_NONE == err);
 		    b_speaker_task_alive = 0;
 		
@@ -210,7 +231,7 @@ alarm_task (void * p_arg)
 	        if (b_speaker_task_alive)
                 {
                     // Kill the speaker task.
-		    OSTaskDel(&g_speaker_tcb, &err);
+		    OSTaskDel(task_tcb(TASK_SPEAKER), &err);
                     assert(OS_ERR_NONE == err);
 		    b_speaker_task_alive = 0;
 		
@@ -232,7 +253,7 @@ alarm_task (void * p_arg)
 	        if (b_speaker_task_alive)
                 {
                     // Kill the speaker task.
-	            OSTaskDel(&g_speaker_tcb, &err);
+	            OSTaskDel(task_tcb(TASK_SPEAKER), &err);
                     assert(OS_ERR_NONE == err);
 	            b_speaker_task_alive = 0;
 
@@ -251,7 +272,7 @@ alarm_task (void * p_arg)
 	    if (b_speaker_task_alive)
             {
                 // Kill the speaker task.
-	        OSTaskDel(&g_speaker_tcb, &err);
+	        OSTaskDel(task_tcb(TASK_SPEAKER), &err);
                 assert(OS_ERR_NONE == err);
 	        b_speaker_task_alive = 0;
 
@@ -269,24 +290,29 @@ alarm_task (void * p_arg)
             assert(0);
         }
 		
+        if (p_waveform != p_previous)
+        {
+            g_alarm_changed_us = sysclock_us();
+
+            // Strobe for the urgent alarms (out of air, rapid ascent).
+            if ((&alarm_high == p_waveform) || (&alarm_medium == p_waveform))
+            {
+                ledpattern_set(ALARM_LED, &g_ledpat_strobe);
+            }
+            else if (&alarm_low == p_waveform)
+            {
+                ledpattern_set(ALARM_LED, &g_ledpat_warn);
+            }
+            else
+            {
+                ledpattern_set(ALARM_LED, &g_ledpat_off);
+            }
+        }
+
         // If necessary, create a speaker task to play the new tone.
 	if (b_create_speaker_task)
         {
-            OSTaskCreate(
-                (OS_TCB     *)&g_speaker_tcb,
-                (CPU_CHAR   *)"Speaker Task",
-                (OS_TASK_PTR ) speaker_task,
-                (void       *) p_waveform,
-                (OS_PRIO     ) SPEAKER_PRIO,
-                (CPU_STK    *)&g_speaker_stack[0],
-                (CPU_STK_SIZE) TASK_STACK_SIZE / 10u,
-                (CPU_STK_SIZE) TASK_STACK_SIZE,
-                (OS_MSG_QTY  ) 0u,
-                (OS_TICK     ) 0u,
-                (void       *) 0,
-                (OS_OPT      ) 0,
-                (OS_ERR     *)&err);
-	        assert(OS_ERR_NONE == err);
+            task_create(TASK_SPEAKER, (void *)p_waveform);
 
 	        b_speaker_task_alive = 1;
 	    }
@@ -10,8 +10,11 @@
 #ifndef _ALARM_H
 #define _ALARM_H
 
+#include <stdint.h>
 #include <os.h>
 
+#include "bus.h"
+
 #define BIT(n)  (1 << (n))
 
 #define ALARM_NONE    BIT(0)
@@ -19,8 +22,18 @@
 #define ALARM_MEDIUM  BIT(2)
 #define ALARM_HIGH    BIT(3)
 
-extern OS_FLAG_GRP g_alarm_flags;
+// Published on g_alarm_topic each time the alarms are worked out.
+typedef struct
+{
+    uint8_t  alarms;            // ALARM_xxx bits.
+} alarm_msg_t;
+
+#define ALARM_Q_SIZE  4         // Room in the alarm task's message queue.
+
+extern bus_topic_t g_alarm_topic;
 
 void alarm_task(void * p_arg);
+void speaker_task(void * p_arg);
+uint64_t alarm_changed_us(void);
 
 #endif /* _ALARM_H */
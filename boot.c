@@ -0,0 +1,50 @@
+/** \file boot.c
+*
+* @brief Boot phase timestamps.
+*
+* Each phase of start-up is stamped with sysclock_us() the first time it
+* is reached, so the times are from sysclock_init(), which follows
+* BSP_Init() in startup_task. BOOT_FIRST_DEPTH is the figure that counts:
+* how long after reset the diver can be told a real depth. It is shown on
+* the hidden diagnostics page.
+*
+* @par
+* COPYRIGHT NOTICE: (C) 2014 Barr Group, LLC.
+* All rights reserved.
+*/
+
+#include <stdint.h>
+
+#include "sysclock.h"
+#include "boot.h"
+
+
+static uint64_t  g_times_us[BOOT_PHASES];
+static uint8_t   g_reached[BOOT_PHASES];
+
+
+/*!
+* @brief Stamp a boot phase. Only the first call per phase counts.
+* @param[in] phase The phase just reached.
+* @note  Phases are each marked by a single task, so no lock is needed.
+*/
+void
+boot_mark (boot_phase_t phase)
+{
+    if (!g_reached[phase])
+    {
+        g_times_us[phase] = sysclock_us();
+        g_reached[phase]  = 1;
+    }
+}
+
+/*!
+* @brief When a phase was reached.
+* @param[in] phase The phase.
+* @return Microseconds since the clock started, or 0 if not reached yet.
+*/
+uint64_t
+boot_time_us (boot_phase_t phase)
+{
+    return g_reached[phase] ? g_times_us[phase] : 0;
+}
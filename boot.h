@@ -0,0 +1,33 @@
+/** \file boot.h
+*
+* @brief Boot phase timestamps.
+*
+* @par
+* COPYRIGHT NOTICE: (C) 2014 Barr Group, LLC.
+* All rights reserved.
+*/
+
+#ifndef _BOOT_H
+#define _BOOT_H
+
+#include <stdint.h>
+
+// 1: start the first depth conversion during start-up and run the
+// calculator's first frame as soon as it is in, rather than a frame later.
+#define BOOT_SENSOR_FIRST   1
+
+typedef enum
+{
+    BOOT_CLOCK,                 // sysclock_init(); time 0.
+    BOOT_SENSOR_STARTED,        // First depth conversion started.
+    BOOT_TASKS_CREATED,         // startup_task done.
+    BOOT_FIRST_DEPTH,           // First depth worked out from a real sample.
+    BOOT_LCD_READY,             // LCD set up by the display task.
+    BOOT_FIRST_FRAME,           // First screen drawn.
+    BOOT_PHASES
+} boot_phase_t;
+
+void     boot_mark(boot_phase_t phase);
+uint64_t boot_time_us(boot_phase_t phase);
+
+#endif /* _BOOT_H */
@@ -62,7 +62,7 @@
 *********************************************************************************************************
 */
 
-#define  BSP_CFG_INT_VECT_TBL_RAM_EN        0    /* Enable (1) vector table in RAM or in ROM (0)       */
+#define  BSP_CFG_INT_VECT_TBL_RAM_EN        1    /* Enable (1) vector table in RAM or in ROM (0)       */
 #define  BSP_CFG_INT_VECT_TBL_SIZE        256    /* Max. number of entries in the interrupt vector tbl */
 
 
@@ -0,0 +1,242 @@
+/** \file bus.c
+*
+* @brief Topic-based publish/subscribe between tasks.
+*
+* A publisher takes a buffer from the topic's pool with bus_alloc(), fills
+* it in place and hands it to bus_publish(). Every subscriber then gets the
+* same buffer through its task message queue, and gives it back with
+* bus_release() when done. The buffer returns to the pool when the last
+* reference goes, so a message is never copied however many tasks read it.
+*
+* Subscribing is done by the receiving task itself, before it first pends
+* on its queue; the task must have been created with room in that queue.
+*
+* @par
+* COPYRIGHT NOTICE: (C) 2014 Barr Group, LLC.
+* All rights reserved.
+*/
+
+#include <assert.h>
+#include <stdint.h>
+
+#include "cpu.h"
+#include "os.h"
+
+#include "sysclock.h"
+#include "trace.h"
+#include "bus.h"
+
+
+// Each buffer starts with this, padded out so the payload stays aligned.
+typedef struct
+{
+    bus_topic_t *     p_topic;
+    uint8_t volatile  refs;
+} bus_hdr_t;
+
+#define BUS_HDR_SIZE        8u
+
+#define BUS_HDR(p_msg)      ((bus_hdr_t *)((uint8_t *)(p_msg) - BUS_HDR_SIZE))
+
+static bus_topic_t *  g_topics;     // Most recently created first.
+
+
+/*!
+* @brief Set up a topic and its pool of n_bufs message buffers.
+* @param[out] p_topic  Topic to set up.
+* @param[in]  p_name   For diagnostics.
+* @param[in]  msg_size Payload bytes per message.
+* @param[in]  n_bufs   Messages that can be in flight at once.
+* @note  Call from start-up code, before the tasks that use it run.
+*/
+void
+bus_topic_create (bus_topic_t * p_topic, char const * p_name, uint16_t msg_size, uint16_t n_bufs)
+{
+    CPU_SR_ALLOC();
+
+
+    assert(sizeof(bus_hdr_t) <= BUS_HDR_SIZE);
+
+    p_topic->p_name          = p_name;
+    p_topic->msg_size        = msg_size;
+    p_topic->n_subs          = 0;
+    p_topic->published       = 0;
+    p_topic->delivered       = 0;
+    p_topic->dropped_no_buf  = 0;
+    p_topic->dropped_q_full  = 0;
+    p_topic->window_start_us = 0;
+    p_topic->window_count    = 0;
+    p_topic->rate_per_s      = 0;
+
+    mempool_create(&p_topic->pool, p_name, BUS_HDR_SIZE + msg_size, n_bufs);
+
+    CPU_CRITICAL_ENTER();
+    p_topic->p_next = g_topics;
+    g_topics = p_topic;
+    CPU_CRITICAL_EXIT();
+}
+
+/*!
+* @brief Have the calling task receive every message on a topic.
+* @param[in] p_topic The topic.
+*/
+void
+bus_subscribe (bus_topic_t * p_topic)
+{
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    assert(p_topic->n_subs < BUS_MAX_SUBS);
+    p_topic->p_subs[p_topic->n_subs++] = OSTCBCurPtr;
+    CPU_CRITICAL_EXIT();
+}
+
+/*!
+* @brief Get a buffer to fill in and publish.
+* @param[in] p_topic The topic it will be published on.
+* @return The payload, or 0 (counted as a drop) if every buffer is in use.
+*/
+void *
+bus_alloc (bus_topic_t * p_topic)
+{
+    bus_hdr_t * p_hdr = (bus_hdr_t *)mempool_get(&p_topic->pool);
+    CPU_SR_ALLOC();
+
+
+    if (0 == p_hdr)
+    {
+        CPU_CRITICAL_ENTER();
+        p_topic->dropped_no_buf++;
+        CPU_CRITICAL_EXIT();
+
+        return 0;
+    }
+
+    p_hdr->p_topic = p_topic;
+    p_hdr->refs    = 1;
+
+    return (uint8_t *)p_hdr + BUS_HDR_SIZE;
+}
+
+/*!
+* @brief Send a filled-in buffer to every subscriber of its topic.
+* @param[in] p_msg From bus_alloc(); the publisher may not touch it after.
+* @note  Task level only. A subscriber whose queue is full misses this one.
+*/
+void
+bus_publish (void * p_msg)
+{
+    bus_hdr_t *   p_hdr   = BUS_HDR(p_msg);
+    bus_topic_t * p_topic = p_hdr->p_topic;
+    uint8_t       n_subs;
+    uint8_t       n_sent  = 0;
+    uint64_t      now_us  = sysclock_us();
+    OS_ERR        err;
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+
+    n_subs = p_topic->n_subs;
+
+    // The publisher's own reference, taken in bus_alloc(), is held until
+    // all the posts are done, in case a subscriber finishes early.
+    p_hdr->refs += n_subs;
+
+    p_topic->published++;
+    if ((now_us - p_topic->window_start_us) >= 1000000u)
+    {
+        p_topic->rate_per_s      = p_topic->window_count;
+        p_topic->window_count    = 0;
+        p_topic->window_start_us = now_us;
+    }
+    p_topic->window_count++;
+
+    CPU_CRITICAL_EXIT();
+
+    for (uint8_t i = 0; i < n_subs; i++)
+    {
+        OSTaskQPost(p_topic->p_subs[i], p_msg, p_topic->msg_size, OS_OPT_POST_FIFO, &err);
+        TRACE_Q_POST(p_topic->p_subs[i], err);
+        if (OS_ERR_NONE == err)
+        {
+            n_sent++;
+        }
+        else
+        {
+            assert(OS_ERR_Q_MAX == err || OS_ERR_MSG_POOL_EMPTY == err);
+            bus_release(p_msg);
+        }
+    }
+
+    CPU_CRITICAL_ENTER();
+    p_topic->delivered      += n_sent;
+    p_topic->dropped_q_full += n_subs - n_sent;
+    CPU_CRITICAL_EXIT();
+
+    bus_release(p_msg);
+}
+
+/*!
+* @brief The topic a received message was published on.
+* @param[in] p_msg The message.
+*/
+bus_topic_t *
+bus_topic_of (void const * p_msg)
+{
+    return BUS_HDR(p_msg)->p_topic;
+}
+
+/*!
+* @brief Give back a received message.
+* @param[in] p_msg The message; not to be touched after.
+*/
+void
+bus_release (void * p_msg)
+{
+    bus_hdr_t * p_hdr = BUS_HDR(p_msg);
+    uint8_t     refs;
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    assert(p_hdr->refs > 0);
+    refs = --p_hdr->refs;
+    CPU_CRITICAL_EXIT();
+
+    if (0 == refs)
+    {
+        mempool_put(&p_hdr->p_topic->pool, p_hdr);
+    }
+}
+
+/*!
+* @brief Copy out traffic figures for every topic.
+* @param[out] p_stats Array to fill.
+* @param[in]  max     Entries in it.
+* @return Entries filled.
+*/
+uint8_t
+bus_report (bus_stats_t * p_stats, uint8_t max)
+{
+    uint8_t n = 0;
+    CPU_SR_ALLOC();
+
+
+    for (bus_topic_t * p_topic = g_topics; p_topic && (n < max); p_topic = p_topic->p_next, n++)
+    {
+        CPU_CRITICAL_ENTER();
+        p_stats[n].p_name     = p_topic->p_name;
+        p_stats[n].n_subs     = p_topic->n_subs;
+        p_stats[n].rate_per_s = p_topic->rate_per_s;
+        p_stats[n].published  = p_topic->published;
+        p_stats[n].delivered  = p_topic->delivered;
+        p_stats[n].dropped    = p_topic->dropped_no_buf + p_topic->dropped_q_full;
+
+        p_stats[n].bufs_used_max = p_topic->pool.n_blks - p_topic->pool.n_free_min;
+        CPU_CRITICAL_EXIT();
+    }
+
+    return n;
+}
@@ -0,0 +1,58 @@
+/** \file bus.h
+*
+* @brief Topic-based publish/subscribe between tasks.
+*
+* @par
+* COPYRIGHT NOTICE: (C) 2014 Barr Group, LLC.
+* All rights reserved.
+*/
+
+#ifndef _BUS_H
+#define _BUS_H
+
+#include <stdint.h>
+
+#include "os.h"
+
+#include "mempool.h"
+
+#define BUS_MAX_SUBS        4
+
+typedef struct bus_topic
+{
+    char const *        p_name;
+    mempool_t           pool;           // Message buffers.
+    uint16_t            msg_size;       // Payload bytes.
+    OS_TCB *            p_subs[BUS_MAX_SUBS];
+    uint8_t             n_subs;
+    uint32_t            published;
+    uint32_t            delivered;      // Counted once per subscriber.
+    uint32_t            dropped_no_buf; // Messages not sent, the pool being empty.
+    uint32_t            dropped_q_full; // Deliveries refused by a full task queue.
+    uint64_t            window_start_us;
+    uint16_t            window_count;
+    uint16_t            rate_per_s;     // Publishes in the latest whole second.
+    struct bus_topic *  p_next;         // All topics, for reporting.
+} bus_topic_t;
+
+typedef struct
+{
+    char const *  p_name;
+    uint8_t       n_subs;
+    uint16_t      rate_per_s;
+    uint32_t      published;
+    uint32_t      delivered;
+    uint32_t      dropped;          // For want of a buffer or of queue space.
+    uint16_t      bufs_used_max;
+} bus_stats_t;
+
+void          bus_topic_create(bus_topic_t * p_topic, char const * p_name,
+                               uint16_t msg_size, uint16_t n_bufs);
+void          bus_subscribe(bus_topic_t * p_topic);
+void *        bus_alloc(bus_topic_t * p_topic);
+void          bus_publish(void * p_msg);
+bus_topic_t * bus_topic_of(void const * p_msg);
+void          bus_release(void * p_msg);
+uint8_t       bus_report(bus_stats_t * p_stats, uint8_t max);
+
+#endif /* _BUS_H */
@@ -0,0 +1,75 @@
+// Dispatch of calculator_task's input events.
+//
+// No kernel calls are made here: calculator.c turns whatever OSPendMulti()
+// returned into a CalcEvent, and this decides what it means. That keeps
+// the logic buildable on a host with simulated event sequences.
+
+#include <stddef.h>
+
+#include "calc_input.h"
+
+// SW2 steps through: metric, imperial, then the depth profile page.
+void nextDisplayMode(CalculationState *state) {
+  if(state->display_page == CALC_PAGE_MAIN && state->display_units == CALC_UNITS_METRIC) {
+    state->display_units = CALC_UNITS_IMPERIAL;
+  } else if(state->display_page == CALC_PAGE_MAIN) {
+    state->display_page = CALC_PAGE_PROFILE;
+    state->display_units = CALC_UNITS_METRIC;
+  } else {
+    state->display_page = CALC_PAGE_MAIN;
+  }
+}
+
+// Apply one event. Returns 1 when it is time to run the next frame.
+uint8_t calc_input_dispatch(CalcEvent event, void const *p_msg,
+                            CalcInputs *p_inputs, CalculationState *p_state) {
+  adc_sample_t const *p_sample;
+
+  switch(event) {
+    case CALC_EV_SAMPLE:
+      p_sample = (adc_sample_t const *)p_msg;
+      p_inputs->adc = p_sample->value;
+      p_inputs->adc_time_us = p_sample->time_us;
+      p_inputs->b_adc_fresh = 1;
+      break;
+
+    case CALC_EV_SW1:
+      // Presses made under water are kept until the diver surfaces.
+      p_inputs->sw1_presses++;
+      break;
+
+    case CALC_EV_SW2:
+      if(p_state->display_page == CALC_PAGE_DIAG) {
+        p_inputs->b_diag_reset = 1;
+      } else if(p_state->display_page == CALC_PAGE_MAIN || p_state->display_page == CALC_PAGE_PROFILE) {
+        nextDisplayMode(p_state);
+      }
+      break;
+
+    case CALC_EV_SW2_LONG:
+      // Kept off SW1, which adds air at the surface on every repeat.
+      // Each hold steps on: diagnostics, tasks, stacks, then back to the
+      // main page.
+      switch(p_state->display_page) {
+        case CALC_PAGE_DIAG:
+          p_state->display_page = CALC_PAGE_TASKS;
+          break;
+        case CALC_PAGE_TASKS:
+          p_state->display_page = CALC_PAGE_STACKS;
+          break;
+        case CALC_PAGE_STACKS:
+          p_state->display_page = CALC_PAGE_MAIN;
+          break;
+        default:
+          p_state->display_page = CALC_PAGE_DIAG;
+          break;
+      }
+      break;
+
+    case CALC_EV_TIMEOUT:
+    default:
+      return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,33 @@
+#ifndef CALC_INPUT_H
+#define CALC_INPUT_H
+
+#include <stdint.h>
+
+// Only the message and state types: no kernel headers, so that the
+// dispatch builds on a host.
+#include "adc_sample.h"
+#include "calculator_state.h"
+
+// Everything that can wake calculator_task between frames.
+typedef enum {
+  CALC_EV_SAMPLE,       // A depth-rate conversion finished; msg is an adc_sample_t.
+  CALC_EV_SW1,          // SW1 pressed (or held): add air at the surface; msg is a button_event_t.
+  CALC_EV_SW2,          // SW2 pressed: next display mode; msg is a button_event_t.
+  CALC_EV_SW2_LONG,     // SW2 held down: on through the hidden pages.
+  CALC_EV_TIMEOUT       // The next frame is due.
+} CalcEvent;
+
+// Inputs gathered between frames, for the stages to consume.
+typedef struct {
+  uint16_t adc;             // Latest conversion result.
+  uint64_t adc_time_us;     // When it completed.
+  uint8_t  b_adc_fresh;     // Set on a new sample; the physics stage clears it.
+  uint16_t sw1_presses;     // Since the physics stage last took them.
+  uint8_t  b_diag_reset;    // SW2 on the diagnostics page; the display stage clears it.
+} CalcInputs;
+
+void nextDisplayMode(CalculationState *state);
+uint8_t calc_input_dispatch(CalcEvent event, void const *p_msg,
+                            CalcInputs *p_inputs, CalculationState *p_state);
+
+#endif
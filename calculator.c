@@ -1,5 +1,8 @@
+#include <stddef.h>
+
 #include "calculator.h"
-#include "calculator_lcd.h"
+#include "calculator_snapshot.h"
+#include "calc_input.h"
 #include "pushbutton.h"
 #include "alarm.h"
 #include "adc.h"
@@ -7,6 +10,13 @@
 #include "scuba.h"
 #include "assert.h"
 #include "dive_time.h"
+#include "trace.h"
+#include "executive.h"
+#include "dive_log.h"
+#include "watchdog.h"
+#include "warmstart.h"
+#include "boot.h"
+#include "diag.h"
 #include  <os.h>
 
 void updateAlarms(CalculationState *currState){
@@ -33,23 +43,47 @@ void updateAlarms(CalculationState *currState){
 }
 
 void postAlarms(CalculationState *currState){	
-  OS_ERR err;
+  alarm_msg_t* p_msg = (alarm_msg_t*)bus_alloc(&g_alarm_topic);
 
-  OSFlagPost(&g_alarm_flags, (OS_FLAGS)currState->current_alarms, OS_OPT_POST_FLAG_SET,&err);
-  assert(OS_ERR_NONE == err);
+  // If every buffer is still in use the topic counts a drop; the next
+  // frame will post the alarms again anyway.
+  if(p_msg != NULL) {
+    p_msg->alarms = currState->current_alarms;
+    bus_publish(p_msg);
+  }
 }
 
+// State shared by the stages below. They all run in calculator_task, one
+// after another, so none of them needs a lock.
+static CalculationState calcState;
+static CalcInputs calcInputs;
+static uint8_t calcWatchdog;
+static uint8_t calcResumed;
+static int64_t depth_rem = 0;
+static int64_t air_rem = 0;
+
 uint16_t getTankChange_ml(){
-  uint16_t buttonPresses=0;
-  // Wait for a signal from the button debouncer.
-  OS_ERR err;
-  while(OSSemPend(&g_sw1_sem, 0, OS_OPT_PEND_NON_BLOCKING, 0, &err), OS_ERR_PEND_WOULD_BLOCK!=err){
-    buttonPresses++;
-  }
-  
+  // SW1 presses counted by the input dispatcher since last time.
+  uint16_t buttonPresses = calcInputs.sw1_presses;
+
+  calcInputs.sw1_presses = 0;
   return buttonPresses*5000;
 }
 
+executive_t g_calc_exec;
+
+#define US_PER_MIN 60000000
+
+// Integrate a per-minute rate over elapsed_us. The remainder is carried to
+// the next call so that truncation does not build up.
+int32_t integrate_per_min(int32_t rate_per_min, uint32_t elapsed_us, int64_t *p_rem) {
+  int64_t total = ((int64_t)rate_per_min * elapsed_us) + *p_rem;
+  int32_t whole = (int32_t)(total / US_PER_MIN);
+
+  *p_rem = total - ((int64_t)whole * US_PER_MIN);
+  return whole;
+}
+
 uint8_t g_b_is_new_timer;
 
 void timer_init() {
@@ -78,103 +112,235 @@ void timer_update(CalculationState *state) {
     }
 }
 
-void calculator_task(void* vptr) {
+// Sensor and physics: read the rate dial, integrate depth and air.
+static void stage_physics(uint32_t elapsed_us) {
+  uint16_t tankChange_ml = 0;
+  uint16_t adc = calcInputs.adc;
 
+  if(calcInputs.b_adc_fresh) {
+    boot_mark(BOOT_FIRST_DEPTH);
+  }
 
-  CalculationState calcState; 
-  uint16_t tankChange_ml = 0;
-  uint16_t adc = 0;
-  OS_ERR err;
+  // Convert again now, so a fresh sample is in by the next frame.
+  calcInputs.b_adc_fresh = 0;
+  adc_start();
+
+  /* RATE and DEPTH */
+  // calculate ASCENT RATE  int32_t rate_mm_per_m;
+  int32_t descent_rate = ADC2RATE(adc);
+  
+  if(calcState.depth_mm > 0 || (calcState.depth_mm == 0 && descent_rate > 0)) {
+      calcState.rate_mm_per_m = 1000 * descent_rate;
+  } else {
+      calcState.rate_mm_per_m = 0;
+  }
+  
+  // calculate DEPTH  int32_t depth_mm;
+  calcState.depth_mm += integrate_per_min(calcState.rate_mm_per_m, elapsed_us, &depth_rem);
+  
+  // no flying divers
+  if(calcState.depth_mm < 0) {
+      calcState.depth_mm = 0;
+  }
+  
   
+  /* UPDATE AIR */
+ 
+  // check SW2 air changes
+  if(calcState.depth_mm == 0) {
+      tankChange_ml =   getTankChange_ml();
+      calcState.air_ml = (calcState.air_ml + tankChange_ml > 2000000) ? 2000000 : calcState.air_ml + tankChange_ml;
+  } else {
+      // calculate  uint32_t air_ml;
+      // gas_rate_in_cl() is per half second: x 120 per minute, x 10 cl -> ml
+      int32_t gas_ml_per_min = (int32_t)gas_rate_in_cl(calcState.depth_mm) * 120 * 10;
+      uint32_t gas_used = (uint32_t)integrate_per_min(gas_ml_per_min, elapsed_us, &air_rem);
+      if(gas_used < calcState.air_ml) {
+        calcState.air_ml -= gas_used;
+      } else {
+        calcState.air_ml = 0;
+      }
+  }
+  
+  /* UPDATE TIMER */
 
-  calculator_lcd_init();
-  adc_init();
-  timer_init();
+  // apply the timer logic
+  timer_update(&calcState);
   
-  // init values
-  calcState.depth_mm = 0;
-  calcState.rate_mm_per_m = 0;
-  calcState.air_ml = 50 * 1000;  // init air in ml
-  calcState.elapsed_time_s = 0;
-  calcState.current_alarms = ALARM_NONE;
-  calcState.display_units = CALC_UNITS_METRIC;
+  // get value from timer
+  calcState.elapsed_time_s = get_dive_time_in_seconds();
+}
+
+static void stage_alarms(uint32_t elapsed_us) {
+  (void)elapsed_us;
+
+  updateAlarms(&calcState);
+  postAlarms(&calcState);
+}
+
+// Display: hand the display task a new snapshot.
+static void stage_display(uint32_t elapsed_us) {
+  (void)elapsed_us;
+
+  if(calcInputs.b_diag_reset) {
+    diag_reset();
+    calcInputs.b_diag_reset = 0;
+  }
+
+  /* PUBLISH STATE */
   
-  for (;;) 
-  {
-    while (1)
-    {
-        // determine  DisplayUnits - check if SW2 has been toggled
-        OSSemPend(&g_sw2_sem, 0, OS_OPT_PEND_NON_BLOCKING, 0, &err);
-        // Check for change
-        if (OS_ERR_NONE == err)
-        {
-          calcState.display_units = (calcState.display_units == CALC_UNITS_METRIC ? CALC_UNITS_IMPERIAL : CALC_UNITS_METRIC);
-        } else if (OS_ERR_PEND_WOULD_BLOCK == err) 
-        {
-          // no update 
-          break;
-        } else 
-        {
-          assert(0); // error state
-        }
+  // The display task renders this at its own rate.
+  calculator_snapshot_publish(&calcState);
+}
+
+// Logging: one record a second while under water.
+static void stage_logging(uint32_t elapsed_us) {
+  dive_log_rec_t rec;
+
+  (void)elapsed_us;
+
+  if(calcState.depth_mm > 0) {
+    rec.time_s = calcState.elapsed_time_s;
+    rec.depth_mm = calcState.depth_mm;
+    rec.air_ml = calcState.air_ml;
+    rec.alarms = calcState.current_alarms;
+    dive_log_append(&rec);
+  }
+}
+
+// Checkpoint: keep the live state over a reset.
+static void stage_checkpoint(uint32_t elapsed_us) {
+  warm_state_t warm;
+
+  (void)elapsed_us;
+
+  warm.calc = calcState;
+  warm.dive_ms = get_dive_time_in_ms();
+  warm.b_timer_running = !is_timer_off();
+  warm.b_new_timer = g_b_is_new_timer;
+  warmstart_save(&warm);
+}
+
+// Stages in the order they run within a frame; periods in ms, budgets in us.
+static exec_stage_t const g_calc_stages[] = {
+  { "Sensor/Physics", 100, 2000, stage_physics },
+  { "Alarms",         100, 1000, stage_alarms  },
+  { "Display",        500,  500, stage_display },
+  { "Logging",       1000,  200, stage_logging },
+  { "Checkpoint",     100,  200, stage_checkpoint },
+};
+
+#define CALC_STAGES (sizeof(g_calc_stages) / sizeof(g_calc_stages[0]))
+
+static exec_stats_t g_calc_stats[CALC_STAGES];
+
+// Between frames, block once on every input and dispatch by source until
+// the next frame is due.
+static void calc_wait(OS_TICK release) {
+  OS_PEND_DATA pend[2];
+  button_event_t* p_button;
+  CalcEvent event;
+  OS_TICK remain;
+  uint8_t b_frame_due = 0;
+  OS_ERR err;
+
+  // Once per frame: the stages have all run.
+  watchdog_beat(calcWatchdog);
+
+  while (!b_frame_due) {
+    remain = release - OSTimeGet(&err);
+    if (remain == 0 || remain > g_calc_exec.release.period_ticks) {
+      // Already there.
+      b_frame_due = calc_input_dispatch(CALC_EV_TIMEOUT, NULL, &calcInputs, &calcState);
+      continue;
     }
-    
-    adc = adc_read();
-  
 
-    /* RATE and DEPTH */
-    // calculate ASCENT RATE  int32_t rate_mm_per_m;
-    int32_t descent_rate = ADC2RATE(adc);
-    
-    if(calcState.depth_mm > 0 || (calcState.depth_mm == 0 && descent_rate > 0)) {
-        calcState.rate_mm_per_m = 1000 * descent_rate;
-    } else {
-        calcState.rate_mm_per_m = 0;
+    pend[0].PendObjPtr = (OS_PEND_OBJ *)adc_queue();
+    pend[1].PendObjPtr = (OS_PEND_OBJ *)&g_button_q;
+
+    (void)OSPendMulti(pend, 2, remain, OS_OPT_PEND_BLOCKING, &err);
+    if (OS_ERR_TIMEOUT == err) {
+      b_frame_due = calc_input_dispatch(CALC_EV_TIMEOUT, NULL, &calcInputs, &calcState);
+      continue;
     }
-    
-    // calculate DEPTH  int32_t depth_mm;
-    calcState.depth_mm += depth_change_in_mm(calcState.rate_mm_per_m / 1000); 
-    
-    // no flying divers
-    if(calcState.depth_mm < 0) {
-        calcState.depth_mm = 0;
+    assert(OS_ERR_NONE == err);
+
+    // Both kinds of message are pool blocks owned by us from here on.
+    if (pend[0].RdyObjPtr != NULL) {
+      b_frame_due |= calc_input_dispatch(CALC_EV_SAMPLE, pend[0].RdyMsgPtr, &calcInputs, &calcState);
+      adc_release((adc_sample_t*)pend[0].RdyMsgPtr);
     }
-    
-    
-    /* UPDATE AIR */
-   
-    // check SW2 air changes
-    if(calcState.depth_mm == 0) {
-        tankChange_ml =   getTankChange_ml();
-        calcState.air_ml = (calcState.air_ml + tankChange_ml > 2000000) ? 2000000 : calcState.air_ml + tankChange_ml;
-    } else {
-        // calculate  uint32_t air_ml;
-        uint32_t gas_rate = gas_rate_in_cl(calcState.depth_mm) * 10; // cl -> ml
-        if(gas_rate < calcState.air_ml) {
-          calcState.air_ml -= gas_rate;
-        } else {
-          calcState.air_ml = 0;
-        }
+    if (pend[1].RdyObjPtr != NULL) {
+      p_button = (button_event_t*)pend[1].RdyMsgPtr;
+      switch (p_button->button) {
+        case BUTTON_SW1:      event = CALC_EV_SW1;      break;
+        case BUTTON_SW2_LONG: event = CALC_EV_SW2_LONG; break;
+        default:              event = CALC_EV_SW2;      break;
+      }
+      b_frame_due |= calc_input_dispatch(event, p_button, &calcInputs, &calcState);
+      button_release(p_button);
     }
-    
-    /* UPDATE TIMER */
-
-    // apply the timer logic
-    timer_update(&calcState);
-    
-    // get value from timer
-    calcState.elapsed_time_s = get_dive_time_in_seconds();
-    
-    // alarms
-    updateAlarms(&calcState);
-    postAlarms(&calcState);
-
-    /* DISPLAY STATE */
-    
-    // determine alarm state  enum CurrentAlarm current_alarm;
-    calculator_lcd_update(&calcState);
-
-    // sleep 500 ms
-    OSTimeDlyHMSM(0, 0, 0, 500, OS_OPT_TIME_HMSM_STRICT, &err);
   }
 }
+
+// Pick up the dive saved before a reset, if there is one. Call from start-up,
+// before calculator_task runs; returns 1 if the dive was resumed.
+uint8_t calculator_resume(void) {
+  warm_state_t warm;
+
+  if(!warmstart_load(&warm)) {
+    return 0;
+  }
+
+  calcState = warm.calc;
+  g_b_is_new_timer = warm.b_new_timer;
+  resume_timer(warm.dive_ms, warm.b_timer_running);
+  calcResumed = 1;
+  return 1;
+}
+
+void calculator_task(void* vptr) {
+
+  (void)vptr;
+
+  // A resumed dive already has its state.
+  if(!calcResumed) {
+    timer_init();
+
+    // init values
+    calcState.depth_mm = 0;
+    calcState.rate_mm_per_m = 0;
+    calcState.air_ml = 50 * 1000;  // init air in ml
+    calcState.elapsed_time_s = 0;
+    calcState.current_alarms = ALARM_NONE;
+    calcState.display_units = CALC_UNITS_METRIC;
+    calcState.display_page = CALC_PAGE_MAIN;
+  }
+  
+  executive_init(&g_calc_exec, "Dive Calculations",
+                 g_calc_stages, g_calc_stats, CALC_STAGES, CALC_FRAME_MS);
+  executive_set_wait(&g_calc_exec, calc_wait);
+
+  calcWatchdog = watchdog_register("Dive Calculations", 5 * CALC_FRAME_MS);
+
+#if BOOT_SENSOR_FIRST
+  {
+    // startup_task started a conversion early on; take it and run the
+    // first frame straight away.
+    OS_MSG_SIZE size;
+    OS_ERR err;
+    adc_sample_t* p_sample = (adc_sample_t*)OSQPend(adc_queue(), 0, OS_OPT_PEND_BLOCKING, &size, NULL, &err);
+    assert(OS_ERR_NONE == err);
+    (void)calc_input_dispatch(CALC_EV_SAMPLE, p_sample, &calcInputs, &calcState);
+    adc_release(p_sample);
+    executive_set_prompt(&g_calc_exec);
+  }
+#else
+  // Have the first sample ready for the first frame.
+  adc_start();
+  boot_mark(BOOT_SENSOR_STARTED);
+#endif
+
+  // Never returns.
+  executive_run(&g_calc_exec);
+}
@@ -2,22 +2,18 @@
 #define CALCULATIONS_H
 
 #include "alarm.h"
+#include "executive.h"
 #include <stdint.h>
 
-enum DisplayUnits {
-  CALC_UNITS_METRIC,
-  CALC_UNITS_IMPERIAL
-};
+#include "calculator_state.h"
 
-typedef struct {
-  int32_t depth_mm;
-  int32_t rate_mm_per_m;
-  uint32_t air_ml;
-  uint32_t elapsed_time_s;
-  enum DisplayUnits display_units;
-  uint8_t current_alarms;
-}CalculationState;
+// calculator_task runs its stages in frames of this length.
+#define CALC_FRAME_MS 100
+
+// Per-stage timing of calculator_task, for diagnostics.
+extern executive_t g_calc_exec;
 
 void calculator_task(void* vptr);
+uint8_t calculator_resume(void);
 
 #endif
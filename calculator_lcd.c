@@ -1,17 +1,25 @@
 #include "calculator_lcd.h"
 
-#include <bsp_glcd.h>
+#include "lcd_fb.h"
+#include "lcd_bigdigit.h"
+#include "profile.h"
+#include "diag.h"
 #include <stdio.h>
 #include <stdarg.h>
 
+// Set to 0 to draw depth and air with the 5x7 font, e.g. to compare the
+// display task's render times against the pre-rendered large digits.
+#define CALCULATOR_LCD_BIG_READOUTS  1
+
+// Label column to the right of a 4 digit large readout.
+#define READOUT_LABEL_COL  (4 * LCD_BIGDIGIT_WIDTH + LCD_FONT_WIDTH)
+
 void
 calculator_lcd_init()
 {
-    BSP_GraphLCD_SetFont(GLYPH_FONT_8_BY_8);
+    lcd_fb_init();
 }
 
-static char* blank_line = "                ";
-
 static
 void lcd_printf(uint8_t line, const char* msg, ...)
 {
@@ -20,10 +28,10 @@ void lcd_printf(uint8_t line, const char* msg, ...)
     
     va_start(args, msg);
     
-    vsprintf(p_str, msg, args);
+    vsnprintf(p_str, sizeof(p_str), msg, args);
     
-    BSP_GraphLCD_String(line, blank_line);
-    BSP_GraphLCD_String(line, (char const *) p_str);
+    // Only the columns that actually change reach the LCD.
+    lcd_fb_string(line, (char const *) p_str);
     
     va_end(args);
 }
@@ -32,15 +40,79 @@ void lcd_printf(uint8_t line, const char* msg, ...)
 #define MM_TO_FT(mm) (mm / 305) // 304.8
 #define ML_TO_L(ml) (ml / 1000)
 
+#if CALCULATOR_LCD_BIG_READOUTS
+static
+void lcd_readout(uint8_t page, int32_t value, const char* label, const char* units)
+{
+    char  p_str[LCD_CHARS_PER_LINE+1];
+    
+    snprintf(p_str, sizeof(p_str), "%4d", value);
+    lcd_bigdigit_string(page, 0, p_str);
+    
+    lcd_fb_text(page, READOUT_LABEL_COL, label);
+    lcd_fb_text(page + 1, READOUT_LABEL_COL, units);
+}
+#endif
+
 void
 calculator_lcd_update(CalculationState* state)
 {
+    static int8_t last_page = -1;
+    
+    // Switching pages starts from a blank screen.
+    if(state->display_page != last_page) {
+        lcd_fb_clear();
+    }
+    
+    if(state->display_page == CALC_PAGE_DIAG) {
+        diag_draw();
+        last_page = state->display_page;
+        return;
+    }
+    
+    if(state->display_page == CALC_PAGE_TASKS) {
+        diag_draw_tasks();
+        last_page = state->display_page;
+        return;
+    }
+    
+    if(state->display_page == CALC_PAGE_STACKS) {
+        diag_draw_stacks();
+        last_page = state->display_page;
+        return;
+    }
+    
+    if(state->display_page == CALC_PAGE_PROFILE) {
+        profile_draw(state->display_page != last_page);
+        last_page = state->display_page;
+        return;
+    }
+    last_page = state->display_page;
+    
     lcd_printf(0, "SCUBIE DUUBA");
     
     if(state->air_ml == 0) {
-        BSP_GraphLCD_Clear();
+        lcd_fb_clear();
         lcd_printf(3, "     YOU LOSE");
     } else {
+        uint32_t seconds = state->elapsed_time_s % 60;
+        uint32_t remainder_minutes = state->elapsed_time_s / 60;
+        uint32_t minutes = remainder_minutes % 60;
+        uint32_t hours = remainder_minutes / 60;
+        
+#if CALCULATOR_LCD_BIG_READOUTS
+        if(state->display_units == CALC_UNITS_METRIC) {
+            lcd_readout(1, MM_TO_M(state->depth_mm), "DEPTH", "M ");
+            lcd_printf(5, "RATE: %+5d M", MM_TO_M(state->rate_mm_per_m));
+        } else {
+            lcd_readout(1, MM_TO_FT(state->depth_mm), "DEPTH", "FT");
+            lcd_printf(5, "RATE: %+5d FT", MM_TO_FT(state->rate_mm_per_m));
+        }
+        
+        lcd_readout(3, ML_TO_L(state->air_ml), "AIR", "L");
+        
+        lcd_printf(6, "EDT:   %01u:%02u:%02u", hours, minutes, seconds);
+#else
         if(state->display_units == CALC_UNITS_METRIC) {
             lcd_printf(2, "DEPTH: %4d M", MM_TO_M(state->depth_mm));
             lcd_printf(3, "RATE: %+5d M", MM_TO_M(state->rate_mm_per_m));          
@@ -51,12 +123,8 @@ calculator_lcd_update(CalculationState* state)
         
         lcd_printf(4, "AIR: %7u L", ML_TO_L(state->air_ml));
         
-        uint32_t seconds = state->elapsed_time_s % 60;
-        uint32_t remainder_minutes = state->elapsed_time_s / 60;
-        uint32_t minutes = remainder_minutes % 60;
-        uint32_t hours = remainder_minutes / 60;
-        
         lcd_printf(5, "EDT:      %01u:%02u:%02u", hours, minutes, seconds);
+#endif
     }
     
         
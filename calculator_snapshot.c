@@ -0,0 +1,77 @@
+/** \file calculator_snapshot.c
+*
+* @brief Lock-free publication of the latest CalculationState.
+*
+* @par
+* COPYRIGHT NOTICE: (C) 2014 Barr Group, LLC.
+* All rights reserved.
+*/
+
+#include <stdint.h>
+#include <string.h>
+
+#include "calculator_snapshot.h"
+
+
+// NOTE: There is exactly one writer (calculator_task) and any number of
+// lower-priority readers. The writer never blocks and never retries.
+//
+// The state is double buffered: generation N lives in g_buffer[N & 1].
+// Before filling a buffer the writer announces the generation it is about
+// to write in g_write_seq; once the copy is complete it publishes that same
+// generation in g_commit_seq. A reader that copied generation N only has to
+// retry if the writer has since started generation N + 2, because that is
+// the first write to land in the same buffer.
+static CalculationState   g_buffer[2];
+static volatile uint32_t  g_write_seq;
+static volatile uint32_t  g_commit_seq;
+static volatile uint32_t  g_retries;
+
+
+/*!
+* @brief Publish a new state snapshot. Only calculator_task may call this.
+* @param[in] p_state The state to copy out.
+*/
+void
+calculator_snapshot_publish (CalculationState const * p_state)
+{
+    uint32_t next = g_commit_seq + 1;
+
+    g_write_seq = next;
+    memcpy(&g_buffer[next & 1u], p_state, sizeof(*p_state));
+    g_commit_seq = next;
+}
+
+/*!
+* @brief Copy out the most recently published snapshot.
+* @param[out] p_state Where to copy the state.
+* @return The generation that was copied; unchanged values mean no new data.
+*/
+uint32_t
+calculator_snapshot_read (CalculationState * p_state)
+{
+    uint32_t seq;
+
+    for (;;)
+    {
+        seq = g_commit_seq;
+        memcpy(p_state, &g_buffer[seq & 1u], sizeof(*p_state));
+
+        // Torn only if the writer has begun reusing this buffer.
+        if ((g_write_seq - seq) < 2u)
+        {
+            return seq;
+        }
+
+        ++g_retries;
+    }
+}
+
+/*!
+* @brief Number of torn reads that had to be retried since reset.
+*/
+uint32_t
+calculator_snapshot_retries (void)
+{
+    return g_retries;
+}
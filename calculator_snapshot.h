@@ -0,0 +1,21 @@
+/** \file calculator_snapshot.h
+*
+* @brief Lock-free publication of the latest CalculationState.
+*
+* @par
+* COPYRIGHT NOTICE: (C) 2014 Barr Group, LLC.
+* All rights reserved.
+*/
+
+#ifndef _CALCULATOR_SNAPSHOT_H
+#define _CALCULATOR_SNAPSHOT_H
+
+#include <stdint.h>
+
+#include "calculator.h"
+
+void     calculator_snapshot_publish(CalculationState const * p_state);
+uint32_t calculator_snapshot_read(CalculationState * p_state);
+uint32_t calculator_snapshot_retries(void);
+
+#endif /* _CALCULATOR_SNAPSHOT_H */
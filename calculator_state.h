@@ -0,0 +1,38 @@
+/** \file calculator_state.h
+*
+* @brief The dive calculator's state, free of any kernel dependency.
+*
+* @par
+* COPYRIGHT NOTICE: (C) 2014 Barr Group, LLC.
+* All rights reserved.
+*/
+
+#ifndef _CALCULATOR_STATE_H
+#define _CALCULATOR_STATE_H
+
+#include <stdint.h>
+
+enum DisplayUnits {
+  CALC_UNITS_METRIC,
+  CALC_UNITS_IMPERIAL
+};
+
+enum DisplayPage {
+  CALC_PAGE_MAIN,
+  CALC_PAGE_PROFILE,
+  CALC_PAGE_DIAG,       // Hidden: hold SW2 down for BUTTON_LONG_MS.
+  CALC_PAGE_TASKS,      // Hidden: hold SW2 down again.
+  CALC_PAGE_STACKS      // Hidden: and again.
+};
+
+typedef struct {
+  int32_t depth_mm;
+  int32_t rate_mm_per_m;
+  uint32_t air_ml;
+  uint32_t elapsed_time_s;
+  enum DisplayUnits display_units;
+  enum DisplayPage display_page;
+  uint8_t current_alarms;
+}CalculationState;
+
+#endif /* _CALCULATOR_STATE_H */
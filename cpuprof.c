@@ -0,0 +1,211 @@
+/** \file cpuprof.c
+*
+* @brief Per-task CPU utilization, measured at each context switch.
+*
+* Every switch charges the time since the previous one to the task being
+* switched out. Tasks are given a slot in a fixed table the first time they
+* are seen, and the slot number is kept in the task's first task-specific
+* register so that most switches never have to search. OSTaskCreate() clears
+* that register, so a task created again with the same TCB (the speaker) is
+* looked up by TCB and keeps its old slot. Time spent in interrupt handlers
+* is charged to whichever task they interrupted.
+*
+* @par
+* COPYRIGHT NOTICE: (C) 2014 Barr Group, LLC.
+* All rights reserved.
+*/
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "cpu.h"
+#include "os.h"
+
+#include "sysclock.h"
+#include "cpuprof.h"
+
+
+// Task register holding slot + 1; zero until the task is first seen.
+#define CPUPROF_REG_ID      0
+
+typedef struct
+{
+    OS_TCB const *  p_tcb;
+    uint32_t        window_us;      // Run time in the current window.
+    uint16_t        permille;       // Share of the last complete window.
+    uint64_t        total_us;
+} cpuprof_slot_t;
+
+static cpuprof_slot_t  g_slots[CPUPROF_MAX_TASKS];
+static uint8_t         g_n_slots;
+
+static uint64_t        g_switch_us;         // When the running task started.
+static uint64_t        g_window_start_us;
+static uint64_t        g_untracked_us;      // Tasks that found the table full.
+
+static uint8_t         gb_ready;
+
+
+/*!
+* @brief Close the current window and work out each task's share of it.
+*/
+static void
+cpuprof_roll (uint32_t window_us)
+{
+    for (uint8_t i = 0; i < g_n_slots; i++)
+    {
+        g_slots[i].permille  = (uint16_t)(((uint64_t)g_slots[i].window_us * 1000u) / window_us);
+        g_slots[i].window_us = 0;
+    }
+}
+
+/*!
+* @brief Start the first window.
+* @note  Call once sysclock_init() has started the clock. Switches before
+*        then are not counted.
+*/
+void
+cpuprof_init (void)
+{
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    g_switch_us       = sysclock_us();
+    g_window_start_us = g_switch_us;
+    gb_ready          = 1;
+    CPU_CRITICAL_EXIT();
+}
+
+/*!
+* @brief Find the outgoing task's slot, giving it one if it is new.
+* @return Slot + 1, or 0 if the table is full.
+*/
+static OS_REG
+cpuprof_slot (OS_TCB * p_from)
+{
+    OS_REG slot = p_from->RegTbl[CPUPROF_REG_ID];
+
+
+    if ((0 != slot) && (slot <= g_n_slots) && (g_slots[slot - 1].p_tcb == p_from))
+    {
+        return slot;
+    }
+
+    for (slot = 0; slot < g_n_slots; slot++)
+    {
+        if (g_slots[slot].p_tcb == p_from)
+        {
+            break;
+        }
+    }
+
+    if (slot == g_n_slots)
+    {
+        if (g_n_slots >= CPUPROF_MAX_TASKS)
+        {
+            return 0;
+        }
+        g_slots[g_n_slots++].p_tcb = p_from;
+    }
+
+    p_from->RegTbl[CPUPROF_REG_ID] = ++slot;
+
+    return slot;
+}
+
+/*!
+* @brief Charge the time since the last switch to the outgoing task.
+* @param[in] p_from The task being switched out.
+* @note  Called from App_OS_TaskSwHook(), with interrupts disabled.
+*/
+void
+cpuprof_switch (OS_TCB * p_from)
+{
+    uint64_t  now_us;
+    uint32_t  ran_us;
+    OS_REG    slot;
+
+
+    if (!gb_ready || (0 == p_from))
+    {
+        return;
+    }
+
+    now_us      = sysclock_us();
+    ran_us      = (uint32_t)(now_us - g_switch_us);
+    g_switch_us = now_us;
+
+    slot = cpuprof_slot(p_from);
+
+    if (0 == slot)
+    {
+        g_untracked_us += ran_us;
+    }
+    else
+    {
+        g_slots[slot - 1].window_us += ran_us;
+        g_slots[slot - 1].total_us  += ran_us;
+    }
+
+    if ((now_us - g_window_start_us) >= (CPUPROF_WINDOW_MS * 1000u))
+    {
+        cpuprof_roll((uint32_t)(now_us - g_window_start_us));
+        g_window_start_us = now_us;
+    }
+}
+
+/*!
+* @brief Copy out per-task utilization.
+* @param[out] p_entries Where to put one entry per task.
+* @param[in]  max       Room in p_entries.
+* @return Number of entries filled in.
+*/
+uint8_t
+cpuprof_get (cpuprof_entry_t * p_entries, uint8_t max)
+{
+    uint8_t n;
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+
+    n = (g_n_slots < max) ? g_n_slots : max;
+    for (uint8_t i = 0; i < n; i++)
+    {
+        p_entries[i].p_name   = (char const *)g_slots[i].p_tcb->NamePtr;
+        p_entries[i].prio     = g_slots[i].p_tcb->Prio;
+        p_entries[i].permille = g_slots[i].permille;
+        p_entries[i].total_us = g_slots[i].total_us;
+    }
+
+    CPU_CRITICAL_EXIT();
+
+    return n;
+}
+
+/*!
+* @brief Print the utilization table on the debug terminal.
+*/
+void
+cpuprof_dump (void)
+{
+    cpuprof_entry_t entries[CPUPROF_MAX_TASKS];
+    uint8_t         n = cpuprof_get(entries, CPUPROF_MAX_TASKS);
+
+
+    printf("Prio  CPU %%   Run ms  Task\n");
+    for (uint8_t i = 0; i < n; i++)
+    {
+        printf("%4u  %3u.%u  %7lu  %s\n",
+               (unsigned)entries[i].prio,
+               (unsigned)(entries[i].permille / 10),
+               (unsigned)(entries[i].permille % 10),
+               (unsigned long)(entries[i].total_us / 1000u),
+               entries[i].p_name);
+    }
+    if (g_untracked_us > 0)
+    {
+        printf("Untracked: %lu ms\n", (unsigned long)(g_untracked_us / 1000u));
+    }
+}
@@ -0,0 +1,36 @@
+/** \file cpuprof.h
+*
+* @brief Per-task CPU utilization, measured at each context switch.
+*
+* @par
+* COPYRIGHT NOTICE: (C) 2014 Barr Group, LLC.
+* All rights reserved.
+*/
+
+#ifndef _CPUPROF_H
+#define _CPUPROF_H
+
+#include <stdint.h>
+
+#include "os.h"
+
+// Set to 0 to take the profiler out of the context switch.
+#define CPUPROF_EN              1
+
+#define CPUPROF_MAX_TASKS       12      // Application plus kernel tasks.
+#define CPUPROF_WINDOW_MS       1000    // Utilization is figured per window.
+
+typedef struct
+{
+    char const *  p_name;
+    OS_PRIO       prio;
+    uint16_t      permille;     // Share of the last complete window.
+    uint64_t      total_us;     // Run time since reset.
+} cpuprof_entry_t;
+
+void    cpuprof_init(void);
+void    cpuprof_switch(OS_TCB * p_from);
+uint8_t cpuprof_get(cpuprof_entry_t * p_entries, uint8_t max);
+void    cpuprof_dump(void);
+
+#endif /* _CPUPROF_H */
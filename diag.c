@@ -0,0 +1,311 @@
+/** \file diag.c
+*
+* @brief Interrupt-disable, scheduler-lock and ISR latency figures.
+*
+* The longest interrupts-disabled time comes from uC/CPU
+* (CPU_CFG_INT_DIS_MEAS_EN) and the longest scheduler lock from the kernel
+* (OS_CFG_SCHED_LOCK_TIME_MEAS_EN). This adds the entry latency of two
+* interrupts:
+*
+* - The tick. CMT0 clears its count on compare match, so the count read on
+*   the way into the tick hook is how long ago the interrupt was raised.
+* - The ADC. The conversion end raises no count, so the time from
+*   adc_start() to the handler is taken instead. The quickest such time is
+*   the conversion itself, and anything more is latency.
+*
+* All of it can be cleared with diag_reset(), and is shown on the hidden
+* LCD page, along with the time start-up took to the first depth reading
+* and the traffic on the message bus. A second page lists the supervised
+* tasks' heartbeat figures and the task blamed for the last watchdog reset,
+* and a third each task's stack use and the tasks' total RAM.
+*
+* @par
+* COPYRIGHT NOTICE: (C) 2014 Barr Group, LLC.
+* All rights reserved.
+*/
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "cpu.h"
+#include "cpu_core.h"
+#include "os.h"
+#include "iorx63n.h"
+
+#include "lcd_fb.h"
+#include "sysclock.h"
+#include "boot.h"
+#include "bus.h"
+#include "intvect.h"
+#include "watchdog.h"
+#include "stkmon.h"
+#include "tasks.h"
+#include "diag.h"
+
+
+#define DIAG_PCLK_MHZ       48u
+#define CMCR_CKS_MASK       0x0003u
+
+// Topics summed into the bus line of the page.
+#define DIAG_BUS_TOPICS     4
+
+// Supervised tasks listed on the tasks page, one per row from row 2.
+#define DIAG_TASK_ROWS      4
+
+// Stacks listed on the stacks page, one per row from row 1.
+#define DIAG_STACK_ROWS     7
+
+// CMT0 clock dividers, indexed by CMCR.CKS.
+static uint16_t const g_cks_div[] = { 8, 32, 128, 512 };
+
+static uint32_t           g_tick_lat_last_ns;
+static uint32_t           g_tick_lat_max_ns;
+
+static uint64_t volatile  g_adc_start_us;
+static uint32_t           g_adc_min_us = UINT32_MAX;
+static uint32_t           g_adc_max_us;
+
+
+/*!
+* @brief Measure the tick interrupt's entry latency.
+* @note  Call first thing from App_OS_TimeTickHook(). Ticks replayed at
+*        task level by tickless.c are not interrupts, and are skipped.
+*/
+void
+diag_tick_entry (void)
+{
+    uint16_t count = CMT0.CMCNT;
+    uint32_t ns;
+
+
+    if (0 == OSIntNestingCtr)
+    {
+        return;
+    }
+
+    ns = ((uint32_t)count * g_cks_div[CMT0.CMCR.WORD & CMCR_CKS_MASK] * 1000u) / DIAG_PCLK_MHZ;
+
+    g_tick_lat_last_ns = ns;
+    if (ns > g_tick_lat_max_ns)
+    {
+        g_tick_lat_max_ns = ns;
+    }
+}
+
+/*!
+* @brief Note that an A/D conversion is being started.
+*/
+void
+diag_adc_start (void)
+{
+    g_adc_start_us = sysclock_us();
+}
+
+/*!
+* @brief Measure the A/D interrupt's start-to-entry time.
+* @note  Call first thing from the A/D interrupt handler.
+*/
+void
+diag_adc_entry (void)
+{
+    uint32_t us = (uint32_t)(sysclock_us() - g_adc_start_us);
+
+    if (us < g_adc_min_us)
+    {
+        g_adc_min_us = us;
+    }
+    if (us > g_adc_max_us)
+    {
+        g_adc_max_us = us;
+    }
+}
+
+/*!
+* @brief Copy out the figures.
+* @param[out] p_stats Where to put them.
+*/
+void
+diag_get (diag_stats_t * p_stats)
+{
+    CPU_TS   lock_max;
+    CPU_SR_ALLOC();
+
+
+#ifdef CPU_CFG_INT_DIS_MEAS_EN
+    p_stats->int_dis_max_us = (uint32_t)CPU_TS32_to_uSec((CPU_TS32)CPU_IntDisMeasMaxCurGet());
+#else
+    p_stats->int_dis_max_us = 0;
+#endif
+
+    CPU_CRITICAL_ENTER();
+#if OS_CFG_SCHED_LOCK_TIME_MEAS_EN > 0u
+    lock_max = OSSchedLockTimeMax;
+#else
+    lock_max = 0;
+#endif
+    p_stats->tick_lat_last_ns = g_tick_lat_last_ns;
+    p_stats->tick_lat_max_ns  = g_tick_lat_max_ns;
+    if (g_adc_max_us >= g_adc_min_us)
+    {
+        p_stats->adc_lat_max_us  = g_adc_max_us - g_adc_min_us;
+        p_stats->adc_conv_min_us = g_adc_min_us;
+    }
+    else
+    {
+        p_stats->adc_lat_max_us  = 0;
+        p_stats->adc_conv_min_us = 0;
+    }
+    CPU_CRITICAL_EXIT();
+
+    p_stats->sched_lock_max_us = (uint32_t)CPU_TS32_to_uSec((CPU_TS32)lock_max);
+}
+
+/*!
+* @brief Start every figure afresh.
+*/
+void
+diag_reset (void)
+{
+    CPU_SR_ALLOC();
+
+
+#ifdef CPU_CFG_INT_DIS_MEAS_EN
+    (void)CPU_IntDisMeasMaxCurReset();
+#endif
+
+    CPU_CRITICAL_ENTER();
+#if OS_CFG_SCHED_LOCK_TIME_MEAS_EN > 0u
+    OSSchedLockTimeMax    = 0;
+    OSSchedLockTimeMaxCur = 0;
+#endif
+    g_tick_lat_last_ns = 0;
+    g_tick_lat_max_ns  = 0;
+    g_adc_min_us       = UINT32_MAX;
+    g_adc_max_us       = 0;
+    CPU_CRITICAL_EXIT();
+}
+
+/*!
+* @brief Draw the diagnostics page.
+* @note  Display task only.
+*/
+void
+diag_draw (void)
+{
+    diag_stats_t stats;
+    bus_stats_t  topics[DIAG_BUS_TOPICS];
+    uint8_t      n_topics;
+    uint32_t     bus_rate    = 0;
+    uint32_t     bus_dropped = 0;
+    char         line[LCD_WIDTH / LCD_FONT_WIDTH + 1];
+
+
+    diag_get(&stats);
+
+    lcd_fb_string(0, "DIAG  SW2: RESET");
+
+    snprintf(line, sizeof(line), "1ST DEPTH %4lums",
+             (unsigned long)(boot_time_us(BOOT_FIRST_DEPTH) / 1000u));
+    lcd_fb_string(1, line);
+
+    snprintf(line, sizeof(line), "IRQ OFF %6luus", (unsigned long)stats.int_dis_max_us);
+    lcd_fb_string(2, line);
+
+    snprintf(line, sizeof(line), "SCHED   %6luus", (unsigned long)stats.sched_lock_max_us);
+    lcd_fb_string(3, line);
+
+    snprintf(line, sizeof(line), "TICK LAT %3lu.%luus",
+             (unsigned long)(stats.tick_lat_max_ns / 1000u),
+             (unsigned long)((stats.tick_lat_max_ns % 1000u) / 100u));
+    lcd_fb_string(4, line);
+
+    snprintf(line, sizeof(line), "ADC LAT %6luus", (unsigned long)stats.adc_lat_max_us);
+    lcd_fb_string(5, line);
+
+    snprintf(line, sizeof(line), "SPURIOUS %6lu", (unsigned long)intvect_spurious_total());
+    lcd_fb_string(6, line);
+
+    // Every topic on one line: messages a second, and those lost.
+    n_topics = bus_report(topics, DIAG_BUS_TOPICS);
+    for (uint8_t i = 0; i < n_topics; i++)
+    {
+        bus_rate    += topics[i].rate_per_s;
+        bus_dropped += topics[i].dropped;
+    }
+    snprintf(line, sizeof(line), "BUS %3lu/S DRP%3lu",
+             (unsigned long)bus_rate, (unsigned long)bus_dropped);
+    lcd_fb_string(7, line);
+}
+
+/*!
+* @brief Draw the tasks page: heartbeat figures and the last watchdog trip.
+* @note  Display task only.
+*/
+void
+diag_draw_tasks (void)
+{
+    watchdog_entry_t entries[DIAG_TASK_ROWS];
+    watchdog_trip_t  trip;
+    uint8_t          n;
+    char             line[LCD_WIDTH / LCD_FONT_WIDTH + 1];
+
+
+    lcd_fb_string(0, "TASKS");
+    lcd_fb_string(1, "TASK    GAP MISS");
+
+    // Worst gap between heartbeats, in ms, and deadlines missed.
+    n = watchdog_report(entries, DIAG_TASK_ROWS);
+    for (uint8_t i = 0; i < DIAG_TASK_ROWS; i++)
+    {
+        line[0] = '\0';
+        if (i < n)
+        {
+            snprintf(line, sizeof(line), "%-8.8s%4lu%4lu", entries[i].p_name,
+                     (unsigned long)entries[i].worst_gap_ms,
+                     (unsigned long)entries[i].misses);
+        }
+        lcd_fb_string(2 + i, line);
+    }
+
+    // The task blamed for the reset before this run, if there was one.
+    if (watchdog_last_trip(&trip))
+    {
+        snprintf(line, sizeof(line), "TRIP %-9.9s%2lu", trip.name,
+                 (unsigned long)trip.trips);
+    }
+    else
+    {
+        snprintf(line, sizeof(line), "TRIP NONE");
+    }
+    lcd_fb_string(6, line);
+}
+
+/*!
+* @brief Draw the stacks page: deepest use of each stack, and the RAM the
+*        task table takes.
+* @note  Display task only.
+*/
+void
+diag_draw_stacks (void)
+{
+    stkmon_entry_t entries[DIAG_STACK_ROWS];
+    uint8_t        n;
+    char           line[LCD_WIDTH / LCD_FONT_WIDTH + 1];
+
+
+    snprintf(line, sizeof(line), "STACKS RAM%5lu", (unsigned long)tasks_ram_bytes());
+    lcd_fb_string(0, line);
+
+    // Words used at worst, of the words given.
+    n = stkmon_get(entries, DIAG_STACK_ROWS);
+    for (uint8_t i = 0; i < DIAG_STACK_ROWS; i++)
+    {
+        line[0] = '\0';
+        if (i < n)
+        {
+            snprintf(line, sizeof(line), "%-8.8s %3u/%3u", entries[i].p_name,
+                     (unsigned)entries[i].used_max, (unsigned)entries[i].size);
+        }
+        lcd_fb_string(1 + i, line);
+    }
+}
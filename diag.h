@@ -0,0 +1,34 @@
+/** \file diag.h
+*
+* @brief Interrupt-disable, scheduler-lock and ISR latency figures.
+*
+* @par
+* COPYRIGHT NOTICE: (C) 2014 Barr Group, LLC.
+* All rights reserved.
+*/
+
+#ifndef _DIAG_H
+#define _DIAG_H
+
+#include <stdint.h>
+
+typedef struct
+{
+    uint32_t  int_dis_max_us;       // Longest CPU_CRITICAL section.
+    uint32_t  sched_lock_max_us;    // Longest OSSchedLock(), idle sleeps aside.
+    uint32_t  tick_lat_last_ns;     // Compare match to the tick hook.
+    uint32_t  tick_lat_max_ns;
+    uint32_t  adc_lat_max_us;       // Start-to-ISR time beyond the quickest.
+    uint32_t  adc_conv_min_us;      // The quickest: conversion time, near enough.
+} diag_stats_t;
+
+void diag_tick_entry(void);
+void diag_adc_start(void);
+void diag_adc_entry(void);
+void diag_get(diag_stats_t * p_stats);
+void diag_reset(void);
+void diag_draw(void);
+void diag_draw_tasks(void);
+void diag_draw_stacks(void);
+
+#endif /* _DIAG_H */
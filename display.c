@@ -0,0 +1,149 @@
+/** \file display.c
+*
+* @brief Display Task
+*
+* @par
+* COPYRIGHT NOTICE: (C) 2014 Barr Group, LLC.
+* All rights reserved.
+*/
+
+#include <assert.h>
+#include <stdint.h>
+
+#include "os.h"
+
+#include "calculator.h"
+#include "calculator_lcd.h"
+#include "calculator_snapshot.h"
+#include "lcd_fb.h"
+#include "profile.h"
+#include "sysclock.h"
+#include "display.h"
+#include "watchdog.h"
+#include "boot.h"
+
+
+#define DISPLAY_PERIOD_MS   250
+
+
+static display_stats_t  g_stats;
+
+
+/*!
+* @brief Copy out the display timing statistics.
+* @param[out] p_stats Where to copy them.
+*/
+void
+display_stats_get (display_stats_t * p_stats)
+{
+    *p_stats = g_stats;
+}
+
+static uint32_t
+display_elapsed_us (uint64_t start)
+{
+    return (uint32_t)(sysclock_us() - start);
+}
+
+/*!
+* @brief Draw one frame and send it, timing each half.
+* @return The LCD transfer error, if the frame was not sent in full.
+*/
+static lcd_dma_err_t
+display_frame (CalculationState * p_state)
+{
+    uint64_t       start;
+    lcd_dma_err_t  err;
+
+
+    start = sysclock_us();
+    calculator_lcd_update(p_state);
+    g_stats.render_last_us = display_elapsed_us(start);
+
+    start = sysclock_us();
+    err = lcd_fb_flush();
+    g_stats.flush_last_us = display_elapsed_us(start);
+
+    if (LCD_DMA_ERR_NONE != err)
+    {
+        ++g_stats.flush_errors;
+        return err;
+    }
+
+    if (g_stats.render_last_us > g_stats.render_max_us)
+    {
+        g_stats.render_max_us = g_stats.render_last_us;
+    }
+    if (g_stats.flush_last_us > g_stats.flush_max_us)
+    {
+        g_stats.flush_max_us = g_stats.flush_last_us;
+    }
+    ++g_stats.frames;
+
+    return LCD_DMA_ERR_NONE;
+}
+
+
+/*!
+* @brief Display Task
+*
+* Renders the most recent calculator snapshot at its own rate, so that the
+* slow SPI writes to the LCD never stretch the calculator's period.
+*/
+void
+display_task (void * p_arg)
+{
+    CalculationState  state;
+    uint32_t          seq;
+    uint32_t          last_seq = 0;
+    uint32_t          next_sample_s = 0;
+    uint32_t          last_elapsed_s = 0;
+    OS_ERR            err;
+    uint8_t           wd_id;
+
+
+    (void)p_arg;    // NOTE: Silence compiler warning about unused param.
+
+    // The LCD is brought up here rather than in startup_task, so that it
+    // does not hold up the tasks above this one.
+    calculator_lcd_init();
+    boot_mark(BOOT_LCD_READY);
+
+    // A redraw may wait on a slow LCD transfer, so allow a few periods.
+    wd_id = watchdog_register("Display", 4 * DISPLAY_PERIOD_MS);
+
+    for (;;)
+    {
+        OSTimeDlyHMSM(0, 0, 0, DISPLAY_PERIOD_MS, OS_OPT_TIME_HMSM_STRICT, &err);
+        assert(OS_ERR_NONE == err);
+        watchdog_beat(wd_id);
+
+        // Skip the redraw entirely if nothing new has been published.
+        seq = calculator_snapshot_read(&state);
+        if (seq != last_seq)
+        {
+            // A new dive or a warm start restarts the dive clock, and the
+            // sample times must restart with it.
+            if (state.elapsed_time_s < last_elapsed_s)
+            {
+                next_sample_s = 0;
+            }
+            last_elapsed_s = state.elapsed_time_s;
+
+            // Feed the profile graph whether or not it is being shown.
+            if (state.elapsed_time_s >= next_sample_s)
+            {
+                profile_sample(state.depth_mm);
+                next_sample_s = state.elapsed_time_s + PROFILE_SAMPLE_S;
+            }
+
+            // On a failed transfer the dirty spans are kept, and the same
+            // snapshot is drawn again next period.
+            if (LCD_DMA_ERR_NONE == display_frame(&state))
+            {
+                boot_mark(BOOT_FIRST_FRAME);
+                last_seq = seq;
+            }
+        }
+    }
+}
@@ -0,0 +1,29 @@
+/** \file display.h
+*
+* @brief Display Task
+*
+* @par
+* COPYRIGHT NOTICE: (C) 2014 Barr Group, LLC.
+* All rights reserved.
+*/
+
+#ifndef _DISPLAY_H
+#define _DISPLAY_H
+
+#include <stdint.h>
+
+// Per-frame cost of the display task, in microseconds.
+typedef struct
+{
+    uint32_t  frames;           // Frames drawn since reset.
+    uint32_t  render_last_us;   // Drawing into the framebuffer.
+    uint32_t  render_max_us;
+    uint32_t  flush_last_us;    // Sending the dirty regions to the LCD.
+    uint32_t  flush_max_us;
+    uint32_t  flush_errors;     // Flushes abandoned on an LCD transfer timeout.
+} display_stats_t;
+
+void display_task(void * p_arg);
+void display_stats_get(display_stats_t * p_stats);
+
+#endif /* _DISPLAY_H */
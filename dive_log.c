@@ -0,0 +1,70 @@
+/** \file dive_log.c
+*
+* @brief Dive log kept in a RAM ring.
+*
+* The newest DIVE_LOG_RECORDS samples are kept; older ones are overwritten.
+*
+* @par
+* COPYRIGHT NOTICE: (C) 2014 Barr Group, LLC.
+* All rights reserved.
+*/
+
+#include <stdint.h>
+
+#include "cpu.h"
+
+#include "dive_log.h"
+
+
+static dive_log_rec_t  g_log[DIVE_LOG_RECORDS];
+static uint32_t        g_written;       // Records ever appended.
+
+
+/*!
+* @brief Add a record, overwriting the oldest once the ring is full.
+* @param[in] p_rec The record.
+*/
+void
+dive_log_append (dive_log_rec_t const * p_rec)
+{
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    g_log[g_written % DIVE_LOG_RECORDS] = *p_rec;
+    g_written++;
+    CPU_CRITICAL_EXIT();
+}
+
+/*!
+* @brief Number of records held.
+*/
+uint16_t
+dive_log_count (void)
+{
+    return (g_written < DIVE_LOG_RECORDS) ? (uint16_t)g_written : DIVE_LOG_RECORDS;
+}
+
+/*!
+* @brief Read back a record.
+* @param[in]  index 0 for the oldest record held.
+* @param[out] p_rec Where to put it.
+* @return 1 if there is such a record; 0 if not.
+*/
+uint8_t
+dive_log_get (uint16_t index, dive_log_rec_t * p_rec)
+{
+    uint8_t b_found = 0;
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    if (index < dive_log_count())
+    {
+        *p_rec  = g_log[(g_written - dive_log_count() + index) % DIVE_LOG_RECORDS];
+        b_found = 1;
+    }
+    CPU_CRITICAL_EXIT();
+
+    return b_found;
+}
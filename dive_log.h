@@ -0,0 +1,29 @@
+/** \file dive_log.h
+*
+* @brief Dive log kept in a RAM ring.
+*
+* @par
+* COPYRIGHT NOTICE: (C) 2014 Barr Group, LLC.
+* All rights reserved.
+*/
+
+#ifndef _DIVE_LOG_H
+#define _DIVE_LOG_H
+
+#include <stdint.h>
+
+#define DIVE_LOG_RECORDS    512     // About 8.5 minutes at 1 Hz.
+
+typedef struct
+{
+    uint32_t  time_s;           // Dive time.
+    int32_t   depth_mm;
+    uint32_t  air_ml;
+    uint8_t   alarms;
+} dive_log_rec_t;
+
+void     dive_log_append(dive_log_rec_t const * p_rec);
+uint16_t dive_log_count(void);
+uint8_t  dive_log_get(uint16_t index, dive_log_rec_t * p_rec);
+
+#endif /* _DIVE_LOG_H */
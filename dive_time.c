@@ -11,80 +11,77 @@
 #include <os.h>
 #include <assert.h>
 
-#include "os_cfg_app.h"
+#include "sysclock.h"
 #include "dive_time.h"
 
 
 // Local defines
 #define ONE_SECOND  1000
-#define NO_ARGS     0
-
-// Local inlines
-#pragma inline
-static OS_TICK period(uint32_t milliseconds) {
-    uint32_t adjustment = ONE_SECOND / OS_CFG_TMR_TASK_RATE_HZ;
-    return (milliseconds / adjustment);
-}
 
 
 // Local Variables
-static OS_TMR g_dive_timer;
-static volatile uint32_t g_elapsed_dive_time;
+// NOTE: Nothing runs while the clock is going; elapsed time is derived on
+// demand from the system clock reading captured at the last start.
+static uint32_t g_start_ms;
+static uint32_t g_accumulated_ms;
 static uint8_t gb_is_timer_stopped = 1;
 
-void 
-increment_timer_callback(void * p_tmr, void * p_arg) {
-    ++g_elapsed_dive_time;
-}
-
 /*!
 * @brief Start the timer (possibly again). This is called when depth != 0.
 */
 void 
 start_timer(uint8_t b_is_new_timer)
 {
-    OS_ERR err;
-    
     if (b_is_new_timer) 
     {
-        g_elapsed_dive_time = 0;
-        OSTmrCreate(&g_dive_timer,
-                    "Elapsed Dive Time",
-                    0,
-                    period(ONE_SECOND),
-                    OS_OPT_TMR_PERIODIC,
-                    increment_timer_callback,
-                    NO_ARGS,
-                    &err);
-        assert(OS_ERR_NONE == err);
+        g_accumulated_ms = 0;
     }
     
-    // We will just start the timer (possibly again)
-    OSTmrStart(&g_dive_timer, &err);
-    assert(OS_ERR_NONE == err);
+    // Resume exactly where we stopped; no partial second is lost.
+    g_start_ms = sysclock_ms();
     gb_is_timer_stopped = 0;
 }
 
 /*!
-* @brief Stop but don't delete the timer
+* @brief Carry on from a reading saved before a reset.
+* @param[in] elapsed_ms The saved reading.
+* @param[in] b_running  Whether the timer was going at the time.
+*/
+void
+resume_timer(uint32_t elapsed_ms, uint8_t b_running)
+{
+    g_accumulated_ms = elapsed_ms;
+    g_start_ms = sysclock_ms();
+    gb_is_timer_stopped = !b_running;
+}
+
+/*!
+* @brief Stop but don't clear the timer
 */
 void
 stop_timer(void)
 {
-    OS_ERR err;
-    if(OS_TMR_STATE_RUNNING == OSTmrStateGet(&g_dive_timer, &err)) {     
-      OSTmrStop(&g_dive_timer,
-                OS_OPT_TMR_NONE,
-                NO_ARGS,
-                &err);
-      assert(OS_ERR_NONE == err);
-    } else {
-      // make sure the status call didn't fail
-      assert(OS_ERR_NONE == err);
+    if (!gb_is_timer_stopped) {
+        g_accumulated_ms += sysclock_ms() - g_start_ms;
     }
     gb_is_timer_stopped = 1;
 }
 
+/*!
+* @brief Return the value of the timer.
+* @return 32-bit unsigned integer representing time in milliseconds
+*/
+uint32_t
+get_dive_time_in_ms(void)
+{
+    uint32_t elapsed_ms = g_accumulated_ms;
+    
+    if (!gb_is_timer_stopped) {
+        elapsed_ms += sysclock_ms() - g_start_ms;
+    }
+    return elapsed_ms;
+}
+
 /*!
 * @brief Return the value of the timer.
 * @return 32-bit unsigned integer representing time in seconds
@@ -92,7 +89,7 @@ stop_timer(void)
 uint32_t
 get_dive_time_in_seconds(void)
 {
-    return g_elapsed_dive_time;
+    return get_dive_time_in_ms() / ONE_SECOND;
 }
 
 /*!
@@ -107,7 +104,7 @@ reset_timer(void)
     TMR_ERR err = TMR_ERR_NONE;
     if (gb_is_timer_stopped) 
     {
-        g_elapsed_dive_time = 0;
+        g_accumulated_ms = 0;
     }
     else
     {
@@ -17,7 +17,9 @@ typedef enum tmr_error {
 
 void start_timer(uint8_t b_is_new_timer);
 void stop_timer(void);
+void resume_timer(uint32_t elapsed_ms, uint8_t b_running);
 uint32_t get_dive_time_in_seconds(void);
+uint32_t get_dive_time_in_ms(void);
 TMR_ERR reset_timer(void);
 uint8_t is_timer_off(void);
 
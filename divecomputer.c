@@ -20,7 +20,6 @@
 
 #include  <cpu_core.h>
 #include  <os.h>
-#include  <bsp_glcd.h>
 
 #include  "bsp.h"
 #include  "bsp_int_vect_tbl.h"
@@ -32,7 +31,16 @@
 #include "common.h"
 #include "adc.h"
 #include "dive_time.h"
+#include "sysclock.h"
+#include "cpuprof.h"
+#include "tickless.h"
 #include "calculator.h"
+#include "alarm.h"
+#include "display.h"
+#include "ledpattern.h"
+#include "watchdog.h"
+#include "boot.h"
+#include "tasks.h"
 
 /*
 *********************************************************************************************************
@@ -61,28 +69,8 @@
 *********************************************************************************************************
 */
 
-// Relative Task Priorities (0 = highest; 15 = idle task)
-#define  STARTUP_PRIO           1   // Highest priority, to launch others.
-#define  DEBOUNCE_PRIO          7   // Every 50 ms, in a timed loop.
-#define  CALC_PRIO             10   // Priority for calculor_task
-#define  ALARM_PRIO             6   // Alarm priority
+// The tasks, their priorities and their stacks are all in tasks.h.
 
-// Allocate Task Stacks
-#define  TASK_STACK_SIZE      128
-
-static CPU_STK  g_startup_stack[TASK_STACK_SIZE];
-static CPU_STK  g_debounce_stack[TASK_STACK_SIZE];
-static CPU_STK  g_calc_stack[TASK_STACK_SIZE];
-static CPU_STK  g_alarm_stack[TASK_STACK_SIZE];
-
-// Allocate Task Control Blocks
-static OS_TCB   g_startup_tcb;
-static OS_TCB   g_debounce_tcb;
-static OS_TCB   g_calc_tcb;
-static OS_TCB   g_alarm_tcb;
-
-// Timers
-static OS_TMR   g_health_timer;
 /*
 *********************************************************************************************************
 *                                            LOCAL MACRO'S
@@ -96,17 +84,6 @@ static OS_TMR   g_health_timer;
 *********************************************************************************************************
 */
 
-/*!
-* @brief Scuba health task
-*/
-void
-scuba_health_task (void * p_tmr, void * p_arg)
-{
-    (void) p_arg;
-    (void) p_tmr;
-    BSP_LED_Toggle(HEALTH_LED);
-}
-
 void
 startup_task (void * p_arg)
 {
@@ -119,85 +96,49 @@ startup_task (void * p_arg)
     BSP_Init();
     CPU_Init();
     Mem_Init();
-
-    // Set the font for the LCD
-    BSP_GraphLCD_SetFont(GLYPH_FONT_8_BY_8);
     
+    // Start the microsecond clock before anything wants a timestamp.
+    sysclock_init();
+    boot_mark(BOOT_CLOCK);
+#if CPUPROF_EN > 0
+    cpuprof_init();
+#endif
+
+    // Set up the depth sensor, and get the first conversion going while
+    // the rest of start-up carries on.
+    adc_init();
+#if BOOT_SENSOR_FIRST
+    adc_start();
+    boot_mark(BOOT_SENSOR_STARTED);
+#endif
+
+    // Carry on with the dive if a watchdog or software reset cut it short.
+    (void)calculator_resume();
+
+    // Let the idle task stretch the tick (BSP_Init() has started it).
+    tickless_init();
+
     // Initialize the reentrant LED driver.
     protectedLED_Init();
     
-    // Create flags shared by alarm and calculator tasks
-    OSFlagCreate(&g_alarm_flags, "Alarm Flag", ALARM_NONE, &err);
-    assert(OS_ERR_NONE == err);
+    // Create the topic the calculator publishes alarms on.
+    bus_topic_create(&g_alarm_topic, "Alarms", sizeof(alarm_msg_t), ALARM_Q_SIZE + 1);
 
-    // Create the semaphores signaled by the button debouncer.
-    OSSemCreate(&g_sw1_sem, "Switch 1", 0, &err);
-    assert(OS_ERR_NONE == err);	
-
-    OSSemCreate(&g_sw2_sem, "Switch 2", 0, &err);
-    assert(OS_ERR_NONE == err);	
-
-    // Create the button debouncer.
-    OSTaskCreate((OS_TCB     *)&g_debounce_tcb,
-                 (CPU_CHAR   *)"Button Debouncer",
-                 (OS_TASK_PTR ) debounce_task,
-                 (void       *) 0,
-                 (OS_PRIO     ) DEBOUNCE_PRIO,
-                 (CPU_STK    *)&g_debounce_stack[0],
-                 (CPU_STK_SIZE) TASK_STACK_SIZE / 10u,
-                 (CPU_STK_SIZE) TASK_STACK_SIZE,
-                 (OS_MSG_QTY  ) 0u,
-                 (OS_TICK     ) 0u,
-                 (void       *) 0,
-                 (OS_OPT      ) 0,
-                 (OS_ERR     *)&err);
-    assert(OS_ERR_NONE == err);
+    // Create the queue and pool for events from the button debouncer.
+    pushbutton_init();
 
-    // Create health timer task
-    OSTmrCreate(&g_health_timer,
-                "Scuba Health Timer",
-                0,
-                167 / 4u,
-                OS_OPT_TMR_PERIODIC,
-                scuba_health_task,
-                NULL,
-                &err);
-    assert(OS_ERR_NONE == err);
-    OSTmrStart(&g_health_timer, &err);
-    assert(OS_ERR_NONE == err);
-    
-     // Create the dive calculator task.
-    OSTaskCreate((OS_TCB     *)&g_calc_tcb,
-                 (CPU_CHAR   *)"Dive Calculations",
-                 (OS_TASK_PTR ) calculator_task,
-                 (void       *) 0,
-                 (OS_PRIO     ) CALC_PRIO,
-                 (CPU_STK    *)&g_calc_stack[0],
-                 (CPU_STK_SIZE) TASK_STACK_SIZE / 10u,
-                 (CPU_STK_SIZE) TASK_STACK_SIZE,
-                 (OS_MSG_QTY  ) 0u,
-                 (OS_TICK     ) 0u,
-                 (void       *) 0,
-                 (OS_OPT      ) 0,
-                 (OS_ERR     *)&err);
-    assert(OS_ERR_NONE == err);
-    
-    // Create the alarm task.
-    OSTaskCreate((OS_TCB     *)&g_alarm_tcb,
-                 (CPU_CHAR   *)"Alarms",
-                 (OS_TASK_PTR ) alarm_task,
-                 (void       *) 0,
-                 (OS_PRIO     ) ALARM_PRIO,
-                 (CPU_STK    *)&g_alarm_stack[0],
-                 (CPU_STK_SIZE) TASK_STACK_SIZE / 10u,
-                 (CPU_STK_SIZE) TASK_STACK_SIZE,
-                 (OS_MSG_QTY  ) 0u,
-                 (OS_TICK     ) 0u,
-                 (void       *) 0,
-                 (OS_OPT      ) 0,
-                 (OS_ERR     *)&err);
-    assert(OS_ERR_NONE == err);
+    // Supervise the tasks created below, and reset if any of them stalls.
+    watchdog_init();
+
+    // Blink the health LED for as long as the timer task is running.
+    ledpattern_init();
+    ledpattern_set(HEALTH_LED, &g_ledpat_health);
     
+    // Create the tasks; the display is the only one that talks to the LCD.
+    tasks_create_all();
+
+    boot_mark(BOOT_TASKS_CREATED);
+
     // Delete the startup task (or enter an infinite loop like other tasks).
     OSTaskDel((OS_TCB *)0, &err);
 
@@ -238,20 +179,7 @@ void  main (void)
     App_OS_SetAllHooks();
 
     // Create the startup task.
-    OSTaskCreate((OS_TCB     *)&g_startup_tcb,
-                 (CPU_CHAR   *)"Startup Task",
-                 (OS_TASK_PTR ) startup_task,
-                 (void       *) 0,
-                 (OS_PRIO     ) STARTUP_PRIO,
-                 (CPU_STK    *)&g_startup_stack[0],
-                 (CPU_STK_SIZE) TASK_STACK_SIZE / 10u,
-                 (CPU_STK_SIZE) TASK_STACK_SIZE ,
-                 (OS_MSG_QTY  ) 0u,
-                 (OS_TICK     ) 0u,
-                 (void       *) 0,
-                 (OS_OPT      ) 0,
-                 (OS_ERR     *)&err);
-    assert(OS_ERR_NONE == err);
+    task_create(TASK_STARTUP, 0);
     
     OSStart(&err);                                              /* Start multitasking (i.e. give control to uC/OS-III). */
 
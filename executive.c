@@ -0,0 +1,177 @@
+/** \file executive.c
+*
+* @brief Multi-rate executive: stages run at their own periods within one task.
+*
+* The executive wakes once per frame on a drift-free periodic release and
+* runs every stage whose period divides the frame count, in table order.
+* Each stage is timed against its budget. Stages never preempt one another,
+* so they can share data without locking.
+*
+* @par
+* COPYRIGHT NOTICE: (C) 2014 Barr Group, LLC.
+* All rights reserved.
+*/
+
+#include <assert.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "cpu.h"
+
+#include "sysclock.h"
+#include "periodic.h"
+#include "executive.h"
+
+
+/*!
+* @brief Prepare an executive; the first frame is one frame_ms from now.
+* @param[out] p_exec   Executive state, owned by the calling task.
+* @param[in]  p_name   For diagnostics.
+* @param[in]  p_stages Stage table, in the order stages should run.
+* @param[out] p_stats  Room for one exec_stats_t per stage.
+* @param[in]  n_stages Entries in the table.
+* @param[in]  frame_ms Frame length; every stage period is a multiple of it.
+*/
+void
+executive_init (executive_t * p_exec, char const * p_name,
+                exec_stage_t const * p_stages, exec_stats_t * p_stats,
+                uint8_t n_stages, uint16_t frame_ms)
+{
+    uint64_t now_us;
+
+
+    p_exec->p_stages = p_stages;
+    p_exec->p_stats  = p_stats;
+    p_exec->n_stages = n_stages;
+    p_exec->frame_ms = frame_ms;
+    p_exec->p_wait   = 0;
+    p_exec->b_prompt = 0;
+    p_exec->frame    = 0;
+
+    periodic_init(&p_exec->release, p_name, frame_ms);
+
+    now_us = sysclock_us();
+    memset(p_stats, 0, n_stages * sizeof(*p_stats));
+    for (uint8_t i = 0; i < n_stages; i++)
+    {
+        assert((p_stages[i].period_ms >= frame_ms) &&
+               ((p_stages[i].period_ms % frame_ms) == 0));
+        p_stats[i].last_start_us = now_us;
+    }
+}
+
+/*!
+* @brief Wait for frames with p_wait instead of simply sleeping.
+* @param[in,out] p_exec Executive set up by executive_init().
+* @param[in]     p_wait Wait function.
+*/
+void
+executive_set_wait (executive_t * p_exec, exec_wait_fn_t p_wait)
+{
+    p_exec->p_wait = p_wait;
+}
+
+/*!
+* @brief Run the first frame as soon as executive_run() is called, rather
+*        than one frame period after executive_init().
+* @param[in,out] p_exec Executive set up by executive_init().
+*/
+void
+executive_set_prompt (executive_t * p_exec)
+{
+    p_exec->b_prompt = 1;
+}
+
+/*!
+* @brief Run the stages, frame after frame.
+* @param[in,out] p_exec Executive set up by executive_init().
+* @note  Does not return.
+*/
+void
+executive_run (executive_t * p_exec)
+{
+    uint32_t misses;
+
+
+    for (;;)
+    {
+        misses = p_exec->release.misses;
+
+        if ((0 == p_exec->frame) && p_exec->b_prompt)
+        {
+            // Frame 0 now; the releases after it keep their usual times.
+        }
+        else if (p_exec->p_wait)
+        {
+            p_exec->p_wait(periodic_next(&p_exec->release));
+            (void)periodic_released(&p_exec->release);
+        }
+        else
+        {
+            (void)periodic_wait(&p_exec->release);
+        }
+
+        // Frames skipped by an overrun still count, so that every stage
+        // keeps its phase against the wall clock rather than slipping.
+        p_exec->frame += p_exec->release.misses - misses;
+
+        for (uint8_t i = 0; i < p_exec->n_stages; i++)
+        {
+            exec_stage_t const * p_stage = &p_exec->p_stages[i];
+            exec_stats_t       * p_stats = &p_exec->p_stats[i];
+            uint32_t             every   = p_stage->period_ms / p_exec->frame_ms;
+            uint64_t             start_us;
+            uint32_t             run_us;
+
+            if ((p_exec->frame % every) != 0)
+            {
+                continue;
+            }
+
+            start_us = sysclock_us();
+            p_stage->p_run((uint32_t)(start_us - p_stats->last_start_us));
+            run_us = (uint32_t)(sysclock_us() - start_us);
+
+            p_stats->last_start_us = start_us;
+            p_stats->runs++;
+            p_stats->last_us = run_us;
+            if (run_us > p_stats->max_us)
+            {
+                p_stats->max_us = run_us;
+            }
+            if (run_us > p_stage->budget_us)
+            {
+                p_stats->overruns++;
+            }
+        }
+
+        p_exec->frame++;
+    }
+}
+
+/*!
+* @brief Copy out each stage's timing.
+* @param[in]  p_exec   Executive to report on.
+* @param[out] p_report Where to put one entry per stage.
+* @param[in]  max      Room in p_report.
+* @return Number of entries filled in.
+*/
+uint8_t
+executive_report (executive_t const * p_exec, exec_report_t * p_report, uint8_t max)
+{
+    uint8_t n = (p_exec->n_stages < max) ? p_exec->n_stages : max;
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    for (uint8_t i = 0; i < n; i++)
+    {
+        p_report[i].p_name    = p_exec->p_stages[i].p_name;
+        p_report[i].period_ms = p_exec->p_stages[i].period_ms;
+        p_report[i].budget_us = p_exec->p_stages[i].budget_us;
+        p_report[i].stats     = p_exec->p_stats[i];
+    }
+    CPU_CRITICAL_EXIT();
+
+    return n;
+}
@@ -0,0 +1,72 @@
+/** \file executive.h
+*
+* @brief Multi-rate executive: stages run at their own periods within one task.
+*
+* @par
+* COPYRIGHT NOTICE: (C) 2014 Barr Group, LLC.
+* All rights reserved.
+*/
+
+#ifndef _EXECUTIVE_H
+#define _EXECUTIVE_H
+
+#include <stdint.h>
+
+#include "os.h"
+
+#include "periodic.h"
+
+// A stage is passed the time since it last ran.
+typedef void (*exec_stage_fn_t)(uint32_t elapsed_us);
+
+// Optional replacement for sleeping between frames: must return once the
+// tick count reaches release, and may handle events until then.
+typedef void (*exec_wait_fn_t)(OS_TICK release);
+
+typedef struct
+{
+    char const *     p_name;
+    uint16_t         period_ms;     // A multiple of the executive's frame.
+    uint16_t         budget_us;     // Worst-case execution time allowed.
+    exec_stage_fn_t  p_run;
+} exec_stage_t;
+
+typedef struct
+{
+    uint32_t  runs;
+    uint32_t  last_us;          // Execution time of the latest run.
+    uint32_t  max_us;
+    uint32_t  overruns;         // Runs that went over budget.
+    uint64_t  last_start_us;
+} exec_stats_t;
+
+typedef struct
+{
+    exec_stage_t const *  p_stages;
+    exec_stats_t *        p_stats;      // One per stage.
+    uint8_t               n_stages;
+    uint16_t              frame_ms;
+    exec_wait_fn_t        p_wait;
+    uint8_t               b_prompt;     // Run frame 0 without waiting.
+    uint32_t              frame;        // Frames since start.
+    periodic_t            release;
+} executive_t;
+
+// One stage's figures, as reported.
+typedef struct
+{
+    char const *  p_name;
+    uint16_t      period_ms;
+    uint16_t      budget_us;
+    exec_stats_t  stats;
+} exec_report_t;
+
+void    executive_init(executive_t * p_exec, char const * p_name,
+                       exec_stage_t const * p_stages, exec_stats_t * p_stats,
+                       uint8_t n_stages, uint16_t frame_ms);
+void    executive_set_wait(executive_t * p_exec, exec_wait_fn_t p_wait);
+void    executive_set_prompt(executive_t * p_exec);
+void    executive_run(executive_t * p_exec);
+uint8_t executive_report(executive_t const * p_exec, exec_report_t * p_report, uint8_t max);
+
+#endif /* _EXECUTIVE_H */
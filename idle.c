@@ -0,0 +1,136 @@
+/** \file idle.c
+*
+* @brief Low-power idle with wake-source accounting.
+*
+* The idle task puts the RX into its WAIT state instead of spinning. The
+* handlers of the interrupts that can wake it call idle_wake_note(), so each
+* wake-up is charged to a source along with how long the CPU slept.
+*
+* @par
+* COPYRIGHT NOTICE: (C) 2014 Barr Group, LLC.
+* All rights reserved.
+*/
+
+#include <stdint.h>
+
+#include <intrinsics.h>
+
+#include "cpu.h"
+
+#include "sysclock.h"
+#include "idle.h"
+
+
+static uint8_t volatile      gb_waiting;
+static idle_wake_t volatile  g_wake_source;
+static uint64_t volatile     g_wake_us;
+
+static idle_stats_t          g_stats;
+
+
+/*!
+* @brief Wait for an interrupt in low power, and account for the sleep.
+* @note  Only for the idle task. Returns with interrupts enabled, after the
+*        handler of the waking interrupt has run.
+*/
+void
+idle_wait (void)
+{
+    uint64_t    start_us;
+    uint64_t    slept_us;
+    idle_wake_t source;
+    CPU_SR_ALLOC();
+
+
+    __disable_interrupt();
+
+    g_wake_source = IDLE_WAKE_OTHER;
+    gb_waiting    = 1;
+    start_us      = sysclock_us();
+
+    // WAIT sets PSW.I, so an interrupt pending since the line above ends
+    // the sleep at once rather than being lost.
+    __wait_for_interrupt();
+
+    CPU_CRITICAL_ENTER();
+
+    // A kernel-aware handler may have switched tasks before we got here,
+    // so stop the clock where the waking handler noted it, if it did.
+    if (gb_waiting)
+    {
+        gb_waiting = 0;
+        g_wake_us  = sysclock_us();
+    }
+
+    source   = g_wake_source;
+    slept_us = g_wake_us - start_us;
+
+    g_stats.wakes[source]++;
+    g_stats.sleep_us[source] += slept_us;
+    g_stats.total_sleep_us   += slept_us;
+
+    CPU_CRITICAL_EXIT();
+}
+
+/*!
+* @brief Record that an interrupt may have ended an idle WAIT.
+* @param[in] source The interrupt calling.
+* @note  Call first thing from interrupt handlers. Does nothing unless the
+*        CPU was actually asleep.
+*/
+void
+idle_wake_note (idle_wake_t source)
+{
+    if (gb_waiting)
+    {
+        gb_waiting    = 0;
+        g_wake_source = source;
+        g_wake_us     = sysclock_us();
+    }
+}
+
+/*!
+* @brief Copy out the wake-up histogram.
+* @param[out] p_stats Where to put it.
+*/
+void
+idle_stats_get (idle_stats_t * p_stats)
+{
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    *p_stats = g_stats;
+    CPU_CRITICAL_EXIT();
+}
+
+/*!
+* @brief Share of time spent asleep since the previous call.
+* @return Percentage, 0 to 100.
+*/
+uint8_t
+idle_percent (void)
+{
+    static uint64_t last_us;
+    static uint64_t last_sleep_us;
+    uint64_t        now_us;
+    uint64_t        sleep_us;
+    uint8_t         percent = 0;
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    now_us   = sysclock_us();
+    sleep_us = g_stats.total_sleep_us;
+    CPU_CRITICAL_EXIT();
+
+    if (now_us > last_us)
+    {
+        percent = (uint8_t)(((sleep_us - last_sleep_us) * 100u) / (now_us - last_us));
+    }
+
+    last_us       = now_us;
+    last_sleep_us = sleep_us;
+
+    return percent;
+}
@@ -0,0 +1,39 @@
+/** \file idle.h
+*
+* @brief Low-power idle with wake-source accounting.
+*
+* @par
+* COPYRIGHT NOTICE: (C) 2014 Barr Group, LLC.
+* All rights reserved.
+*/
+
+#ifndef _IDLE_H
+#define _IDLE_H
+
+#include <stdint.h>
+
+// Interrupts that can end an idle WAIT.
+typedef enum
+{
+    IDLE_WAKE_OTHER,        // An interrupt that does not call idle_wake_note().
+    IDLE_WAKE_TICK,         // uC/OS-III tick (CMT0).
+    IDLE_WAKE_SYSCLOCK,     // Microsecond clock wrap (CMT1).
+    IDLE_WAKE_ADC,          // Depth sensor conversion complete.
+    IDLE_WAKE_LCD_DMA,      // LCD transfer complete.
+
+    IDLE_WAKE_SOURCES
+} idle_wake_t;
+
+typedef struct
+{
+    uint32_t  wakes[IDLE_WAKE_SOURCES];     // Wake-ups per source.
+    uint64_t  sleep_us[IDLE_WAKE_SOURCES];  // Time asleep, by what ended it.
+    uint64_t  total_sleep_us;
+} idle_stats_t;
+
+void    idle_wait(void);
+void    idle_wake_note(idle_wake_t source);
+void    idle_stats_get(idle_stats_t * p_stats);
+uint8_t idle_percent(void);
+
+#endif /* _IDLE_H */
@@ -0,0 +1,159 @@
+/** \file intvect.c
+*
+* @brief Run-time interrupt vector registration and per-vector counters.
+*
+* The vector table lives in RAM (BSP_CFG_INT_VECT_TBL_RAM_EN), so drivers
+* install their own handlers from their init functions rather than having
+* them wired into interrupts.c. Every slot nobody has claimed points at a
+* small stub there that lands in intvect_spurious(), which counts the hit
+* and masks the source so a stuck request cannot hold the CPU.
+*
+* Handlers that bracket their body with INTVECT_ENTER()/INTVECT_EXIT() also
+* get a hit count and their longest run. The time comes from CPU_TS_Get32(),
+* so only handlers below the kernel's interrupt boundary should do this.
+*
+* @par
+* COPYRIGHT NOTICE: (C) 2014 Barr Group, LLC.
+* All rights reserved.
+*/
+
+#include <assert.h>
+#include <stdint.h>
+
+#include <bsp_cfg.h>
+#include "cpu.h"
+#include "cpu_core.h"
+#include <bsp_int_vect_tbl.h>
+
+#include "intvect.h"
+
+
+#if BSP_CFG_INT_VECT_TBL_RAM_EN == 0
+#error "intvect_register() needs the vector table in RAM; see bsp_cfg.h"
+#endif
+
+// Below this the vectors are exceptions and software interrupts, which
+// have no enable bit.
+#define INTVECT_FIRST_IER   16
+
+#define IER_BASE            0x00087200
+
+static uint16_t           g_spurious[INTVECT_COUNT];
+static uint32_t volatile  g_spurious_total;
+
+#if INTVECT_STATS_EN > 0
+static uint32_t           g_hits[INTVECT_COUNT];
+static CPU_TS32           g_max_ts[INTVECT_COUNT];
+#endif
+
+
+/*!
+* @brief Install the handler for one vector.
+* @param[in] vect The vector number.
+* @param[in] isr  Its handler, usually the kernel-aware assembly wrapper.
+* @note  Call before unmasking the interrupt in the ICU.
+*/
+void
+intvect_register (uint8_t vect, CPU_FNCT_VOID isr)
+{
+    assert(0 != isr);
+
+    BSP_IntVectSet(vect, isr);
+}
+
+/*!
+* @brief Count an interrupt that arrived with no handler registered.
+* @param[in] vect The vector taken.
+* @note  Called from the BSP_IntSpurious_xxx() stubs in interrupts.c. The
+*        source is masked, since nothing is going to clear it.
+*/
+void
+intvect_spurious (uint8_t vect)
+{
+    uint8_t volatile * p_IER;
+
+
+    if (g_spurious[vect] < UINT16_MAX)
+    {
+        g_spurious[vect]++;
+    }
+    g_spurious_total++;
+
+    if (vect >= INTVECT_FIRST_IER)
+    {
+        p_IER   = (uint8_t volatile *)(IER_BASE + vect / 8);
+        *p_IER &= (uint8_t)~(1u << (vect % 8));
+    }
+}
+
+/*!
+* @brief Account for one run of an instrumented handler.
+* @param[in] vect  The vector.
+* @param[in] start CPU_TS_Get32() on the way in.
+* @note  Use through INTVECT_EXIT().
+*/
+void
+intvect_hit (uint8_t vect, CPU_TS32 start)
+{
+#if INTVECT_STATS_EN > 0
+    CPU_TS32 cost = CPU_TS_Get32() - start;
+
+    g_hits[vect]++;
+    if (cost > g_max_ts[vect])
+    {
+        g_max_ts[vect] = cost;
+    }
+#else
+    (void)vect;
+    (void)start;
+#endif
+}
+
+/*!
+* @brief List the vectors that have been hit or taken spuriously.
+* @param[out] p_out Room for max entries.
+* @param[in]  max   How many fit.
+* @return Entries filled in, lowest vector first.
+*/
+uint8_t
+intvect_report (intvect_entry_t * p_out, uint8_t max)
+{
+    uint8_t         n = 0;
+    intvect_entry_t entry;
+    CPU_TS32        max_ts = 0;
+    CPU_SR_ALLOC();
+
+
+    for (uint16_t v = 0; (v < INTVECT_COUNT) && (n < max); v++)
+    {
+        entry.vect = (uint8_t)v;
+
+        CPU_CRITICAL_ENTER();
+        entry.spurious = g_spurious[v];
+#if INTVECT_STATS_EN > 0
+        entry.hits     = g_hits[v];
+        max_ts         = g_max_ts[v];
+#else
+        entry.hits     = 0;
+#endif
+        CPU_CRITICAL_EXIT();
+
+        entry.max_us = (uint32_t)CPU_TS32_to_uSec(max_ts);
+
+        if ((0 != entry.hits) || (0 != entry.spurious))
+        {
+            p_out[n++] = entry;
+        }
+    }
+
+    return n;
+}
+
+/*!
+* @brief Spurious interrupts on all vectors since reset.
+*/
+uint32_t
+intvect_spurious_total (void)
+{
+    return g_spurious_total;
+}
@@ -0,0 +1,51 @@
+/** \file intvect.h
+*
+* @brief Run-time interrupt vector registration and per-vector counters.
+*
+* @par
+* COPYRIGHT NOTICE: (C) 2014 Barr Group, LLC.
+* All rights reserved.
+*/
+
+#ifndef _INTVECT_H
+#define _INTVECT_H
+
+#include <stdint.h>
+
+#include "cpu.h"
+#include "cpu_core.h"
+
+// Set to 0 to compile every INTVECT_ENTER()/INTVECT_EXIT() pair away.
+#define INTVECT_STATS_EN    1
+
+#define INTVECT_COUNT       256
+
+// One vector that has seen any activity.
+typedef struct
+{
+    uint8_t   vect;
+    uint32_t  hits;             // Through INTVECT_EXIT().
+    uint32_t  max_us;           // Longest INTVECT_ENTER() to INTVECT_EXIT().
+    uint32_t  spurious;         // Taken with no handler registered.
+} intvect_entry_t;
+
+void      intvect_register(uint8_t vect, CPU_FNCT_VOID isr);
+void      intvect_spurious(uint8_t vect);
+void      intvect_hit(uint8_t vect, CPU_TS32 start);
+uint8_t   intvect_report(intvect_entry_t * p_out, uint8_t max);
+uint32_t  intvect_spurious_total(void);
+
+#if INTVECT_STATS_EN > 0
+
+// Bracket the body of a kernel-aware handler; ENTER declares a local.
+#define INTVECT_ENTER(vect)     CPU_TS32 const intvect_start = CPU_TS_Get32()
+#define INTVECT_EXIT(vect)      intvect_hit((vect), intvect_start)
+
+#else
+
+#define INTVECT_ENTER(vect)
+#define INTVECT_EXIT(vect)
+
+#endif /* INTVECT_STATS_EN */
+
+#endif /* _INTVECT_H */
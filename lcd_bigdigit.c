@@ -0,0 +1,131 @@
+/** \file lcd_bigdigit.c
+*
+* @brief Double-height digits for the primary readouts.
+*
+* The glyphs are the 5x7 font doubled in both directions, pre-rendered
+* into page order so each one is a straight copy into the framebuffer.
+*
+* @par
+* COPYRIGHT NOTICE: (C) 2014 Barr Group, LLC.
+* All rights reserved.
+*/
+
+#include <stdint.h>
+#include <string.h>
+
+#include "lcd_fb.h"
+#include "lcd_bigdigit.h"
+
+
+#define GLYPH_WIDTH     10
+#define GLYPH_PLUS      10
+#define GLYPH_MINUS     11
+#define GLYPH_SPACE     12
+
+// [glyph][page][column]; page 0 is the upper half.
+static uint8_t const g_bigdigits[][LCD_BIGDIGIT_PAGES][GLYPH_WIDTH] =
+{
+    {   // '0'
+        {0xF8, 0xF8, 0x06, 0x06, 0x86, 0x86, 0x66, 0x66, 0xF8, 0xF8},
+        {0x1F, 0x1F, 0x66, 0x66, 0x61, 0x61, 0x60, 0x60, 0x1F, 0x1F},
+    },
+    {   // '1'
+        {0x00, 0x00, 0x18, 0x18, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0x00},
+        {0x00, 0x00, 0x60, 0x60, 0x7F, 0x7F, 0x60, 0x60, 0x00, 0x00},
+    },
+    {   // '2'
+        {0x18, 0x18, 0x06, 0x06, 0x06, 0x06, 0x86, 0x86, 0x78, 0x78},
+        {0x60, 0x60, 0x78, 0x78, 0x66, 0x66, 0x61, 0x61, 0x60, 0x60},
+    },
+    {   // '3'
+        {0x06, 0x06, 0x06, 0x06, 0x66, 0x66, 0x9E, 0x9E, 0x06, 0x06},
+        {0x18, 0x18, 0x60, 0x60, 0x60, 0x60, 0x61, 0x61, 0x1E, 0x1E},
+    },
+    {   // '4'
+        {0x80, 0x80, 0x60, 0x60, 0x18, 0x18, 0xFE, 0xFE, 0x00, 0x00},
+        {0x07, 0x07, 0x06, 0x06, 0x06, 0x06, 0x7F, 0x7F, 0x06, 0x06},
+    },
+    {   // '5'
+        {0x7E, 0x7E, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x86, 0x86},
+        {0x18, 0x18, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x1F, 0x1F},
+    },
+    {   // '6'
+        {0xE0, 0xE0, 0x98, 0x98, 0x86, 0x86, 0x86, 0x86, 0x00, 0x00},
+        {0x1F, 0x1F, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x1E, 0x1E},
+    },
+    {   // '7'
+        {0x06, 0x06, 0x06, 0x06, 0x86, 0x86, 0x66, 0x66, 0x1E, 0x1E},
+        {0x00, 0x00, 0x7E, 0x7E, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00},
+    },
+    {   // '8'
+        {0x78, 0x78, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x78, 0x78},
+        {0x1E, 0x1E, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x1E, 0x1E},
+    },
+    {   // '9'
+        {0x78, 0x78, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0xF8, 0xF8},
+        {0x00, 0x00, 0x61, 0x61, 0x61, 0x61, 0x19, 0x19, 0x07, 0x07},
+    },
+    {   // '+'
+        {0x80, 0x80, 0x80, 0x80, 0xF8, 0xF8, 0x80, 0x80, 0x80, 0x80},
+        {0x01, 0x01, 0x01, 0x01, 0x1F, 0x1F, 0x01, 0x01, 0x01, 0x01},
+    },
+    {   // '-'
+        {0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+        {0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01},
+    },
+    {   // ' '
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    },
+};
+
+
+static uint8_t
+lcd_bigdigit_glyph (char c)
+{
+    if ((c >= '0') && (c <= '9'))
+    {
+        return (uint8_t)(c - '0');
+    }
+    else if ('+' == c)
+    {
+        return GLYPH_PLUS;
+    }
+    else if ('-' == c)
+    {
+        return GLYPH_MINUS;
+    }
+    else
+    {
+        return GLYPH_SPACE;
+    }
+}
+
+/*!
+* @brief Draw a string of double-height digits.
+* @param[in] page  Upper page of the two the digits occupy.
+* @param[in] col   Left-most column.
+* @param[in] p_str Digits, '+', '-' or ' '; anything else draws as a space.
+*/
+void
+lcd_bigdigit_string (uint8_t page, uint8_t col, char const * p_str)
+{
+    uint8_t upper[LCD_WIDTH];
+    uint8_t lower[LCD_WIDTH];
+    uint8_t len = 0;
+
+    memset(upper, 0, sizeof(upper));
+    memset(lower, 0, sizeof(lower));
+
+    while (*p_str && (col + len + LCD_BIGDIGIT_WIDTH <= LCD_WIDTH))
+    {
+        uint8_t glyph = lcd_bigdigit_glyph(*p_str++);
+
+        memcpy(&upper[len], g_bigdigits[glyph][0], GLYPH_WIDTH);
+        memcpy(&lower[len], g_bigdigits[glyph][1], GLYPH_WIDTH);
+        len += LCD_BIGDIGIT_WIDTH;
+    }
+
+    lcd_fb_write(page,     col, upper, len);
+    lcd_fb_write(page + 1, col, lower, len);
+}
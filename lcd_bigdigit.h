@@ -0,0 +1,20 @@
+/** \file lcd_bigdigit.h
+*
+* @brief Double-height digits for the primary readouts.
+*
+* @par
+* COPYRIGHT NOTICE: (C) 2014 Barr Group, LLC.
+* All rights reserved.
+*/
+
+#ifndef _LCD_BIGDIGIT_H
+#define _LCD_BIGDIGIT_H
+
+#include <stdint.h>
+
+#define LCD_BIGDIGIT_WIDTH  12      // 10 pixel glyph plus 2 of spacing.
+#define LCD_BIGDIGIT_PAGES   2
+
+void lcd_bigdigit_string(uint8_t page, uint8_t col, char const * p_str);
+
+#endif /* _LCD_BIGDIGIT_H */
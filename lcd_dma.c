@@ -0,0 +1,246 @@
+/** \file lcd_dma.c
+*
+* @brief DMA-driven SPI transport for the ST7579 LCD controller.
+*
+* The Glyph driver writes every byte to RSPI0 and then busy-waits for it to
+* shift out. Here short command sequences are still written by the CPU, but
+* display data is handed to DMAC channel 0, which feeds RSPI0 from the
+* transmit-buffer-empty request while the calling task sleeps on a semaphore.
+*
+* @par
+* COPYRIGHT NOTICE: (C) 2014 Barr Group, LLC.
+* All rights reserved.
+*/
+
+#include <assert.h>
+#include <stdint.h>
+
+#include "os.h"
+#include "iorx63n.h"
+
+#include "lcd_dma.h"
+#include "idle.h"
+#include "trace.h"
+#include "intvect.h"
+
+
+// Interrupt request flags, one byte per vector.
+#define IR_BASE             0x00087000
+
+// LCD control lines, per the YRDKRX63N schematic.
+#define LCD_RS              PORT5.PODR.BIT.B1   // Low = command, high = data.
+#define LCD_CS              PORTJ.PODR.BIT.B3   // Active low.
+
+// Interrupt vectors used (see interrupts.c).
+#define VECT_RSPI0_SPTI0    40
+#define VECT_DMAC_DMAC0I    198
+
+// The kernel-aware wrapper in lcddmaisr.s, which calls lcd_dma_isr().
+void LcdDmaIsr(void);
+
+#define DMA_COMPLETE_IPL    8
+
+// DMAC0 transfer mode: normal mode, 32-bit units, peripheral request.
+#define DMTMD_NORMAL_32BIT_IRQ  0x0201u
+// DMAC0 address mode: increment source, fixed destination.
+#define DMAMD_SRC_INC           0x8000u
+// DMAC0 interrupt: raise DMAC0I when the transfer count reaches zero.
+#define DMINT_DTIE              0x10u
+
+#define LCD_DMA_MAX_LEN     128
+#define LCD_DMA_TIMEOUT     10      // Ticks; a full page takes well under 1.
+
+
+// Signaled by the DMAC0I handler when a data transfer has been handed off.
+static OS_SEM    g_lcd_dma_sem;
+
+// RSPI0 is in longword access mode, so bytes are widened before transfer.
+static uint32_t  g_dma_buf[LCD_DMA_MAX_LEN];
+
+
+/*!
+* @brief Wait for the last frame to leave the RSPI0 shift register.
+*/
+static void
+lcd_spi_wait_idle (void)
+{
+    while (RSPI0.SPSR.BIT.IDLNF)
+    {
+        // Never more than one byte time.
+    }
+}
+
+/*!
+* @brief Abandon a data transfer that never completed.
+* @note  Leaves DMAC0 and RSPI0 ready for the next lcd_dma_data().
+*/
+static void
+lcd_dma_abort (void)
+{
+    OS_ERR err;
+
+
+    // Stop the requests first, so none is left pending for the DMAC.
+    RSPI0.SPCR.BIT.SPTIE = 0;
+    DMAC0.DMCNT.BIT.DTE = 0;
+    DMAC0.DMSTS.BIT.DTIF = 0;
+    *(uint8_t volatile *)(IR_BASE + VECT_RSPI0_SPTI0) = 0;
+
+    // A completion that raced the timeout must not satisfy the next pend.
+    OSSemSet(&g_lcd_dma_sem, 0, &err);
+    assert(OS_ERR_NONE == err);
+
+    lcd_spi_wait_idle();
+    LCD_CS = 1;
+}
+
+/*!
+* @brief Take over RSPI0 from the Glyph driver and prepare DMAC channel 0.
+* @note  BSP_Init() must already have brought up the LCD controller.
+*/
+void
+lcd_dma_init (void)
+{
+    OS_ERR err;
+
+    OSSemCreate(&g_lcd_dma_sem, "LCD DMA Done", 0, &err);
+    assert(OS_ERR_NONE == err);
+
+    /* Protection off */
+    SYSTEM.PRCR.WORD = 0xA503u;
+
+    // Cancel the DMAC/DTC module stop.
+    SYSTEM.MSTPCRA.BIT.MSTPA28 = 0;
+
+    /* Protection on */
+    SYSTEM.PRCR.WORD = 0xA500u;
+
+    // Transmit-only, so nothing has to drain the receive buffer.
+    RSPI0.SPCR.BIT.SPE = 0;
+    RSPI0.SPCR.BIT.TXMD = 1;
+    RSPI0.SPDCR.BIT.SPLW = 1;
+    RSPI0.SPCR.BIT.SPE = 1;
+
+    // Route the RSPI0 transmit-buffer-empty request to DMAC0.
+    ICU.DMRSR0 = VECT_RSPI0_SPTI0;
+
+    uint8_t * p_IER_spti = (uint8_t *)(0x00087200 + VECT_RSPI0_SPTI0 / 8);
+    uint8_t * p_IER_dmac = (uint8_t *)(0x00087200 + VECT_DMAC_DMAC0I / 8);
+    uint8_t * p_IPR_dmac = (uint8_t *)(0x00087300 + VECT_DMAC_DMAC0I);
+
+    intvect_register(VECT_DMAC_DMAC0I, LcdDmaIsr);
+
+    *p_IER_spti |= (1u << (VECT_RSPI0_SPTI0 % 8));
+    *p_IPR_dmac  = DMA_COMPLETE_IPL;
+    *p_IER_dmac |= (1u << (VECT_DMAC_DMAC0I % 8));
+
+    DMAC0.DMCNT.BIT.DTE = 0;
+    DMAC0.DMTMD.WORD = DMTMD_NORMAL_32BIT_IRQ;
+    DMAC0.DMAMD.WORD = DMAMD_SRC_INC;
+    DMAC0.DMINT.BYTE = DMINT_DTIE;
+    DMAC0.DMDAR = (uint32_t)&RSPI0.SPDR;
+
+    DMAC.DMAST.BIT.DMST = 1;
+}
+
+/*!
+* @brief Send a short command sequence with the CPU.
+* @param[in] p_cmd Command bytes.
+* @param[in] len   Number of command bytes.
+*/
+void
+lcd_dma_command (uint8_t const * p_cmd, uint8_t len)
+{
+    lcd_spi_wait_idle();
+
+    LCD_CS = 0;
+    LCD_RS = 0;
+
+    while (len--)
+    {
+        while (!RSPI0.SPSR.BIT.SPTEF)
+        {
+            // Transmit buffer full.
+        }
+        RSPI0.SPDR.LONG = *p_cmd++;
+    }
+
+    lcd_spi_wait_idle();
+    LCD_CS = 1;
+}
+
+/*!
+* @brief Send display data by DMA and sleep until the transfer completes.
+* @param[in] p_data Display bytes.
+* @param[in] len    Number of display bytes (at most one LCD page).
+* @return LCD_DMA_ERR_TIMEOUT if the transfer did not complete in time; the
+*         panel may then hold part of the data.
+*/
+lcd_dma_err_t
+lcd_dma_data (uint8_t const * p_data, uint8_t len)
+{
+    OS_ERR err;
+
+    assert(len <= LCD_DMA_MAX_LEN);
+
+    if (0 == len)
+    {
+        return LCD_DMA_ERR_NONE;
+    }
+
+    for (uint8_t i = 0; i < len; i++)
+    {
+        g_dma_buf[i] = p_data[i];
+    }
+
+    lcd_spi_wait_idle();
+
+    LCD_CS = 0;
+    LCD_RS = 1;
+
+    DMAC0.DMSAR = (uint32_t)&g_dma_buf[0];
+    DMAC0.DMCRA = len;
+    DMAC0.DMCNT.BIT.DTE = 1;
+
+    // The first request is raised as soon as SPTIE is set.
+    RSPI0.SPCR.BIT.SPTIE = 1;
+
+    OSSemPend(&g_lcd_dma_sem, LCD_DMA_TIMEOUT, OS_OPT_PEND_BLOCKING, 0, &err);
+    TRACE_SEM_PEND(&g_lcd_dma_sem, err);
+    if (OS_ERR_NONE != err)
+    {
+        lcd_dma_abort();
+        return LCD_DMA_ERR_TIMEOUT;
+    }
+
+    // The DMAC is done; the last byte may still be shifting out.
+    lcd_spi_wait_idle();
+    LCD_CS = 1;
+
+    return LCD_DMA_ERR_NONE;
+}
+
+/*!
+*
+* @brief DMAC0 Transfer Complete Interrupt Handler
+*/
+void
+lcd_dma_isr (void)
+{
+    OS_ERR err;
+
+
+    idle_wake_note(IDLE_WAKE_LCD_DMA);
+    TRACE_ISR_ENTER(VECT_DMAC_DMAC0I);
+    INTVECT_ENTER(VECT_DMAC_DMAC0I);
+
+    RSPI0.SPCR.BIT.SPTIE = 0;
+    DMAC0.DMSTS.BIT.DTIF = 0;
+
+    TRACE_SEM_POST(&g_lcd_dma_sem);
+    OSSemPost(&g_lcd_dma_sem, OS_OPT_POST_1, &err);
+    assert(OS_ERR_NONE == err);
+
+    INTVECT_EXIT(VECT_DMAC_DMAC0I);
+    TRACE_ISR_EXIT(VECT_DMAC_DMAC0I);
+}
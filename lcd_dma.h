@@ -0,0 +1,27 @@
+/** \file lcd_dma.h
+*
+* @brief DMA-driven SPI transport for the ST7579 LCD controller.
+*
+* @par
+* COPYRIGHT NOTICE: (C) 2014 Barr Group, LLC.
+* All rights reserved.
+*/
+
+#ifndef _LCD_DMA_H
+#define _LCD_DMA_H
+
+#include <stdint.h>
+
+typedef enum
+{
+    LCD_DMA_ERR_NONE = 0,
+    LCD_DMA_ERR_TIMEOUT,        // The transfer was abandoned; CS is high again.
+} lcd_dma_err_t;
+
+void          lcd_dma_init(void);
+void          lcd_dma_command(uint8_t const * p_cmd, uint8_t len);
+lcd_dma_err_t lcd_dma_data(uint8_t const * p_data, uint8_t len);
+
+void lcd_dma_isr(void);
+
+#endif /* _LCD_DMA_H */
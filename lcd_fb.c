@@ -0,0 +1,289 @@
+/** \file lcd_fb.c
+*
+* @brief LCD framebuffer with dirty-region tracking.
+*
+* Drawing only touches RAM. Each page remembers the span of columns whose
+* bytes actually changed, and lcd_fb_flush() sends just those spans to the
+* ST7579, one DMA transfer per dirty page.
+*
+* @par
+* COPYRIGHT NOTICE: (C) 2014 Barr Group, LLC.
+* All rights reserved.
+*/
+
+#include <stdint.h>
+#include <string.h>
+
+#include "lcd_fb.h"
+#include "lcd_dma.h"
+
+
+// ST7579 instructions (H[1:0] = 00, the basic instruction set).
+#define ST7579_SET_Y(page)      (0x40 | (page))
+#define ST7579_SET_X(col)       (0x80 | (col))
+
+#define NOT_DIRTY               0xFF
+
+// Glyphs for ' ' through '_', 5 columns each, LSB at the top.
+// Lower case is folded to upper case before lookup.
+#define FONT_FIRST              ' '
+#define FONT_LAST               '_'
+#define FONT_GLYPH_WIDTH        5
+
+static uint8_t const g_font_5x7[FONT_LAST - FONT_FIRST + 1][FONT_GLYPH_WIDTH] =
+{
+    {0x00, 0x00, 0x00, 0x00, 0x00},     // ' '
+    {0x00, 0x00, 0x5F, 0x00, 0x00},     // '!'
+    {0x00, 0x07, 0x00, 0x07, 0x00},     // '"'
+    {0x14, 0x7F, 0x14, 0x7F, 0x14},     // '#'
+    {0x24, 0x2A, 0x7F, 0x2A, 0x12},     // '$'
+    {0x23, 0x13, 0x08, 0x64, 0x62},     // '%'
+    {0x36, 0x49, 0x55, 0x22, 0x50},     // '&'
+    {0x00, 0x05, 0x03, 0x00, 0x00},     // '''
+    {0x00, 0x1C, 0x22, 0x41, 0x00},     // '('
+    {0x00, 0x41, 0x22, 0x1C, 0x00},     // ')'
+    {0x08, 0x2A, 0x1C, 0x2A, 0x08},     // '*'
+    {0x08, 0x08, 0x3E, 0x08, 0x08},     // '+'
+    {0x00, 0x50, 0x30, 0x00, 0x00},     // ','
+    {0x08, 0x08, 0x08, 0x08, 0x08},     // '-'
+    {0x00, 0x60, 0x60, 0x00, 0x00},     // '.'
+    {0x20, 0x10, 0x08, 0x04, 0x02},     // '/'
+    {0x3E, 0x51, 0x49, 0x45, 0x3E},     // '0'
+    {0x00, 0x42, 0x7F, 0x40, 0x00},     // '1'
+    {0x42, 0x61, 0x51, 0x49, 0x46},     // '2'
+    {0x21, 0x41, 0x45, 0x4B, 0x31},     // '3'
+    {0x18, 0x14, 0x12, 0x7F, 0x10},     // '4'
+    {0x27, 0x45, 0x45, 0x45, 0x39},     // '5'
+    {0x3C, 0x4A, 0x49, 0x49, 0x30},     // '6'
+    {0x01, 0x71, 0x09, 0x05, 0x03},     // '7'
+    {0x36, 0x49, 0x49, 0x49, 0x36},     // '8'
+    {0x06, 0x49, 0x49, 0x29, 0x1E},     // '9'
+    {0x00, 0x36, 0x36, 0x00, 0x00},     // ':'
+    {0x00, 0x56, 0x36, 0x00, 0x00},     // ';'
+    {0x08, 0x14, 0x22, 0x41, 0x00},     // '<'
+    {0x14, 0x14, 0x14, 0x14, 0x14},     // '='
+    {0x00, 0x41, 0x22, 0x14, 0x08},     // '>'
+    {0x02, 0x01, 0x51, 0x09, 0x06},     // '?'
+    {0x32, 0x49, 0x79, 0x41, 0x3E},     // '@'
+    {0x7E, 0x11, 0x11, 0x11, 0x7E},     // 'A'
+    {0x7F, 0x49, 0x49, 0x49, 0x36},     // 'B'
+    {0x3E, 0x41, 0x41, 0x41, 0x22},     // 'C'
+    {0x7F, 0x41, 0x41, 0x22, 0x1C},     // 'D'
+    {0x7F, 0x49, 0x49, 0x49, 0x41},     // 'E'
+    {0x7F, 0x09, 0x09, 0x09, 0x01},     // 'F'
+    {0x3E, 0x41, 0x49, 0x49, 0x7A},     // 'G'
+    {0x7F, 0x08, 0x08, 0x08, 0x7F},     // 'H'
+    {0x00, 0x41, 0x7F, 0x41, 0x00},     // 'I'
+    {0x20, 0x40, 0x41, 0x3F, 0x01},     // 'J'
+    {0x7F, 0x08, 0x14, 0x22, 0x41},     // 'K'
+    {0x7F, 0x40, 0x40, 0x40, 0x40},     // 'L'
+    {0x7F, 0x02, 0x0C, 0x02, 0x7F},     // 'M'
+    {0x7F, 0x04, 0x08, 0x10, 0x7F},     // 'N'
+    {0x3E, 0x41, 0x41, 0x41, 0x3E},     // 'O'
+    {0x7F, 0x09, 0x09, 0x09, 0x06},     // 'P'
+    {0x3E, 0x41, 0x51, 0x21, 0x5E},     // 'Q'
+    {0x7F, 0x09, 0x19, 0x29, 0x46},     // 'R'
+    {0x46, 0x49, 0x49, 0x49, 0x31},     // 'S'
+    {0x01, 0x01, 0x7F, 0x01, 0x01},     // 'T'
+    {0x3F, 0x40, 0x40, 0x40, 0x3F},     // 'U'
+    {0x1F, 0x20, 0x40, 0x20, 0x1F},     // 'V'
+    {0x3F, 0x40, 0x38, 0x40, 0x3F},     // 'W'
+    {0x63, 0x14, 0x08, 0x14, 0x63},     // 'X'
+    {0x07, 0x08, 0x70, 0x08, 0x07},     // 'Y'
+    {0x61, 0x51, 0x49, 0x45, 0x43},     // 'Z'
+    {0x00, 0x7F, 0x41, 0x41, 0x00},     // '['
+    {0x02, 0x04, 0x08, 0x10, 0x20},     // '\'
+    {0x00, 0x41, 0x41, 0x7F, 0x00},     // ']'
+    {0x04, 0x02, 0x01, 0x02, 0x04},     // '^'
+    {0x40, 0x40, 0x40, 0x40, 0x40},     // '_'
+};
+
+static uint8_t  g_fb[LCD_PAGES][LCD_WIDTH];
+
+// Inclusive span of changed columns per page; lo == NOT_DIRTY when clean.
+static uint8_t  g_dirty_lo[LCD_PAGES];
+static uint8_t  g_dirty_hi[LCD_PAGES];
+
+
+static void
+lcd_fb_mark (uint8_t page, uint8_t lo, uint8_t hi)
+{
+    if ((NOT_DIRTY == g_dirty_lo[page]) || (lo < g_dirty_lo[page]))
+    {
+        g_dirty_lo[page] = lo;
+    }
+    if ((NOT_DIRTY == g_dirty_hi[page]) || (hi > g_dirty_hi[page]))
+    {
+        g_dirty_hi[page] = hi;
+    }
+}
+
+/*!
+* @brief Clear the framebuffer and force the whole panel out on next flush.
+*/
+void
+lcd_fb_init (void)
+{
+    lcd_dma_init();
+
+    memset(g_fb, 0, sizeof(g_fb));
+    for (uint8_t page = 0; page < LCD_PAGES; page++)
+    {
+        g_dirty_lo[page] = NOT_DIRTY;
+        g_dirty_hi[page] = NOT_DIRTY;
+        lcd_fb_mark(page, 0, LCD_WIDTH - 1);
+    }
+}
+
+/*!
+* @brief Blank the whole display.
+*/
+void
+lcd_fb_clear (void)
+{
+    static uint8_t const blank[LCD_WIDTH];
+
+    for (uint8_t page = 0; page < LCD_PAGES; page++)
+    {
+        lcd_fb_write(page, 0, blank, LCD_WIDTH);
+    }
+}
+
+/*!
+* @brief Copy a run of column bytes into one page, noting what changed.
+* @param[in] page   Page (row of 8 pixels).
+* @param[in] col    First column.
+* @param[in] p_bits Column bytes, LSB at the top.
+* @param[in] len    Number of columns; clipped at the right edge.
+*/
+void
+lcd_fb_write (uint8_t page, uint8_t col, uint8_t const * p_bits, uint8_t len)
+{
+    uint8_t lo = NOT_DIRTY;
+    uint8_t hi = 0;
+
+    if ((page >= LCD_PAGES) || (col >= LCD_WIDTH))
+    {
+        return;
+    }
+    if (len > LCD_WIDTH - col)
+    {
+        len = LCD_WIDTH - col;
+    }
+
+    for (uint8_t i = 0; i < len; i++, col++)
+    {
+        if (g_fb[page][col] != p_bits[i])
+        {
+            g_fb[page][col] = p_bits[i];
+            if (NOT_DIRTY == lo)
+            {
+                lo = col;
+            }
+            hi = col;
+        }
+    }
+
+    if (NOT_DIRTY != lo)
+    {
+        lcd_fb_mark(page, lo, hi);
+    }
+}
+
+/*!
+* @brief Render 5x7 text into a line of column bytes.
+* @return Number of columns used.
+*/
+static uint8_t
+lcd_fb_render (uint8_t * p_line, uint8_t max, char const * p_str)
+{
+    uint8_t col = 0;
+
+    memset(p_line, 0, max);
+
+    while (*p_str && (col + LCD_FONT_WIDTH <= max))
+    {
+        char c = *p_str++;
+
+        if ((c >= 'a') && (c <= 'z'))
+        {
+            c -= ('a' - 'A');
+        }
+        if ((c < FONT_FIRST) || (c > FONT_LAST))
+        {
+            c = ' ';
+        }
+
+        memcpy(&p_line[col], g_font_5x7[c - FONT_FIRST], FONT_GLYPH_WIDTH);
+        col += LCD_FONT_WIDTH;
+    }
+
+    return col;
+}
+
+/*!
+* @brief Draw 5x7 text, leaving the rest of the page alone.
+* @param[in] page  Page (row of 8 pixels).
+* @param[in] col   Left-most column.
+* @param[in] p_str Text; clipped at the right edge.
+*/
+void
+lcd_fb_text (uint8_t page, uint8_t col, char const * p_str)
+{
+    uint8_t line[LCD_WIDTH];
+
+    if (col < LCD_WIDTH)
+    {
+        lcd_fb_write(page, col, line, lcd_fb_render(line, LCD_WIDTH - col, p_str));
+    }
+}
+
+/*!
+* @brief Draw a full line of 5x7 text, blanking whatever follows the string.
+* @param[in] page  Page (row of 8 pixels).
+* @param[in] p_str Text; anything past LCD_WIDTH / LCD_FONT_WIDTH is dropped.
+*/
+void
+lcd_fb_string (uint8_t page, char const * p_str)
+{
+    uint8_t line[LCD_WIDTH];
+
+    (void)lcd_fb_render(line, LCD_WIDTH, p_str);
+    lcd_fb_write(page, 0, line, LCD_WIDTH);
+}
+
+/*!
+* @brief Send every dirty span to the LCD.
+* @return The first transfer error; that page and those after it stay dirty.
+* @note  Blocks the caller while each span is transferred by DMA.
+*/
+lcd_dma_err_t
+lcd_fb_flush (void)
+{
+    uint8_t       cmd[2];
+    lcd_dma_err_t err;
+
+    for (uint8_t page = 0; page < LCD_PAGES; page++)
+    {
+        uint8_t lo = g_dirty_lo[page];
+
+        if (NOT_DIRTY == lo)
+        {
+            continue;
+        }
+
+        cmd[0] = ST7579_SET_Y(page);
+        cmd[1] = ST7579_SET_X(lo);
+        lcd_dma_command(cmd, sizeof(cmd));
+        err = lcd_dma_data(&g_fb[page][lo], g_dirty_hi[page] - lo + 1);
+        if (LCD_DMA_ERR_NONE != err)
+        {
+            return err;
+        }
+
+        g_dirty_lo[page] = NOT_DIRTY;
+        g_dirty_hi[page] = NOT_DIRTY;
+    }
+
+    return LCD_DMA_ERR_NONE;
+}
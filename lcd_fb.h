@@ -0,0 +1,29 @@
+/** \file lcd_fb.h
+*
+* @brief LCD framebuffer with dirty-region tracking.
+*
+* @par
+* COPYRIGHT NOTICE: (C) 2014 Barr Group, LLC.
+* All rights reserved.
+*/
+
+#ifndef _LCD_FB_H
+#define _LCD_FB_H
+
+#include <stdint.h>
+
+#include "lcd_dma.h"
+
+#define LCD_WIDTH           96      // Pixels.
+#define LCD_PAGES            8      // Rows of 8 pixels each.
+
+#define LCD_FONT_WIDTH       6      // 5x7 glyph plus one column of spacing.
+
+void          lcd_fb_init(void);
+void          lcd_fb_clear(void);
+void          lcd_fb_write(uint8_t page, uint8_t col, uint8_t const * p_bits, uint8_t len);
+void          lcd_fb_text(uint8_t page, uint8_t col, char const * p_str);
+void          lcd_fb_string(uint8_t page, char const * p_str);
+lcd_dma_err_t lcd_fb_flush(void);
+
+#endif /* _LCD_FB_H */
@@ -0,0 +1,53 @@
+
+
+
+    extern     _lcd_dma_isr
+    extern     _OSIntExit
+    extern     _OSIntNestingCtr
+    extern     _OSTCBCurPtr
+
+;/*$PAGE*/
+;********************************************************************************************************
+;                                            LcdDmaIsr()
+;********************************************************************************************************
+
+    section .text:CODE:ROOT
+
+    public  _LcdDmaIsr
+
+_LcdDmaIsr:
+
+    PUSHC   FPSW                        ; Save processor registers on the stack
+    PUSHM   R1-R15
+    MVFACHI R1
+    MVFACMI R2
+    PUSHM   R1-R2
+
+    MOV.L   #_OSIntNestingCtr, R5       ; Notify uC/OS-III about ISR
+    MOV.B   [R5], R3
+    ADD     #1, R3
+    MOV.B   R3, [R5]
+
+    CMP     #1, R3                      ; if (OSNestingCtr == 1)
+    BNE     _LcdDmaIsr1
+    MOV.L   #_OSTCBCurPtr, R5           ; Save current task's SP into its TCB
+    MOV.L   [R5], R3
+    MOV.L   R0, [R3]
+
+_LcdDmaIsr1  MOV.L   #_lcd_dma_isr, R5
+    JSR     R5
+
+    MOV.L   #_OSIntExit, R5
+    JSR     R5                          ; Notify uC/OS-III about end of ISR
+
+    POPM    R1-R2                       ; Restore processor registers from stack
+    SHLL    #16, R2
+    MVTACLO R2
+    MVTACHI R1
+    POPM    R1-R15
+    POPC    FPSW
+
+    RTE
+
+    end
+
@@ -0,0 +1,281 @@
+/** \file ledpattern.c
+*
+* @brief Timer-driven LED patterns.
+*
+* Every user LED is given a pattern, and a single OS timer callback works
+* out the state of all of them at once. The results are gathered into port
+* D and E bit masks and handed to protectedLED_Write(), one masked write
+* per port, so however many LEDs change, each tick costs the same.
+*
+* The timer is one-shot. Each tick arms it again for the next time any LED
+* changes: the next blink edge, LEDPAT_TICK_MS while one is breathing, or
+* not at all while every LED is steady. A 3 Hz blink so costs six ticks a
+* second, and steady LEDs none, rather than a timer wheel entry every
+* LEDPAT_TICK_MS that would cut every tickless sleep short.
+*
+* ledpattern_render() decides a single LED from its pattern and the time
+* since the pattern was set. It lives in ledpattern_render.c, away from
+* anything target specific, so that pattern timing is tested on the host.
+*
+* While TASKLIGHT_EN is set, LEDs 7 to 15 belong to tasklight.c and the
+* engine leaves them alone.
+*
+* @par
+* COPYRIGHT NOTICE: (C) 2014 Barr Group, LLC.
+* All rights reserved.
+*/
+
+#include <assert.h>
+#include <stdint.h>
+
+#include "cpu.h"
+#include "os.h"
+
+#include "tasklight.h"
+#include "protectedled.h"
+#include "ledpattern.h"
+
+
+#define LEDPAT_N_LEDS       (LEDPAT_LAST_LED - LEDPAT_FIRST_LED + 1)
+
+// Rounded up to whole timer task periods, so no edge is shown early.
+#define LEDPAT_MS_TO_TMR(ms)    ((((ms) * OS_CFG_TMR_TASK_RATE_HZ) + 999u) / 1000u)
+
+// The LEDs are active low. Port bits per the YRDKRX63N schematic.
+typedef struct
+{
+    uint8_t  b_port_e;          // Port E if set, else port D.
+    uint8_t  bit;
+} ledpat_pin_t;
+
+static ledpat_pin_t const g_pins[LEDPAT_N_LEDS] =
+{
+    { 0, 5 },   { 1, 3 },   { 0, 2 },                   // LEDs  4 -  6
+    { 1, 0 },   { 0, 4 },   { 1, 2 },                   // LEDs  7 -  9
+    { 0, 1 },   { 0, 7 },   { 0, 3 },                   // LEDs 10 - 12
+    { 1, 1 },   { 0, 0 },   { 0, 6 },                   // LEDs 13 - 15
+};
+
+#if TASKLIGHT_EN > 0
+#define LEDPAT_OWNED_LAST   6
+#else
+#define LEDPAT_OWNED_LAST   LEDPAT_LAST_LED
+#endif
+
+typedef struct
+{
+    ledpat_t  pat;
+    uint32_t  start_ms;         // ledpattern_now_ms() when the pattern was set.
+    uint16_t  dither;           // Error carried between ticks by BREATHE.
+    uint8_t   gen;              // Bumped by every change of pattern.
+} ledpat_slot_t;
+
+ledpat_t const g_ledpat_off    = { LEDPAT_OFF,     0,   0 };
+ledpat_t const g_ledpat_health = { LEDPAT_BLINK, 334, 167 };
+ledpat_t const g_ledpat_strobe = { LEDPAT_BLINK, 120,  40 };
+ledpat_t const g_ledpat_warn   = { LEDPAT_BLINK, 1000, 200 };
+
+static ledpat_slot_t  g_slots[LEDPAT_N_LEDS];
+static uint8_t        g_pd_mask;
+static uint8_t        g_pe_mask;
+
+static OS_TMR         g_ledpat_timer;
+
+
+static void ledpattern_tick(void * p_tmr, void * p_arg);
+
+
+/*!
+* @brief The engine's time: the kernel tick count in milliseconds.
+*/
+static uint32_t
+ledpattern_now_ms (void)
+{
+    OS_ERR err;
+
+    return (uint32_t)(((uint64_t)OSTimeGet(&err) * 1000u) / OS_CFG_TICK_RATE_HZ);
+}
+
+/*!
+* @brief Run the engine again after a while.
+* @param[in] delay_ms How long; 0 for the next timer task period.
+* @note  Task or timer callback context.
+*/
+static void
+ledpattern_arm (uint32_t delay_ms)
+{
+    OS_ERR  err;
+    OS_TICK dly = LEDPAT_MS_TO_TMR(delay_ms);
+
+
+    if (0 == dly)
+    {
+        dly = 1;
+    }
+
+    // A one-shot timer's delay is set when it is created, so it is made
+    // afresh. Stopping one that has already fired does no harm.
+    (void)OSTmrStop(&g_ledpat_timer, OS_OPT_TMR_NONE, NULL, &err);
+
+    OSTmrCreate(&g_ledpat_timer,
+                "LED Patterns",
+                dly,
+                0,
+                OS_OPT_TMR_ONE_SHOT,
+                ledpattern_tick,
+                NULL,
+                &err);
+    assert(OS_ERR_NONE == err);
+
+    OSTmrStart(&g_ledpat_timer, &err);
+    assert(OS_ERR_NONE == err);
+}
+
+/*!
+* @brief Work out every LED, update both ports, and arm the next tick.
+* @note  OS timer callback.
+*/
+static void
+ledpattern_tick (void * p_tmr, void * p_arg)
+{
+    uint8_t       pd = 0;
+    uint8_t       pe = 0;
+    uint32_t      now_ms = ledpattern_now_ms();
+    uint32_t      next_ms = LEDPAT_NEVER;
+    uint32_t      led_next_ms;
+    ledpat_slot_t slot;
+    CPU_SR_ALLOC();
+
+
+    (void)p_tmr;
+    (void)p_arg;
+
+    for (uint8_t i = 0; i <= LEDPAT_OWNED_LAST - LEDPAT_FIRST_LED; i++)
+    {
+        CPU_CRITICAL_ENTER();
+        slot = g_slots[i];
+        CPU_CRITICAL_EXIT();
+
+        led_next_ms = ledpattern_next_ms(&slot.pat, now_ms - slot.start_ms);
+        if (led_next_ms < next_ms)
+        {
+            next_ms = led_next_ms;
+        }
+
+        // Active low: a set bit is an unlit LED.
+        if (!ledpattern_render(&slot.pat, now_ms - slot.start_ms, &slot.dither))
+        {
+            if (g_pins[i].b_port_e)
+            {
+                pe |= (uint8_t)(1u << g_pins[i].bit);
+            }
+            else
+            {
+                pd |= (uint8_t)(1u << g_pins[i].bit);
+            }
+        }
+
+        // Unless ledpattern_set() has started the slot afresh meanwhile.
+        CPU_CRITICAL_ENTER();
+        if (g_slots[i].gen == slot.gen)
+        {
+            g_slots[i].dither = slot.dither;
+        }
+        CPU_CRITICAL_EXIT();
+    }
+
+    protectedLED_Write(g_pd_mask, pd, g_pe_mask, pe);
+
+    if (LEDPAT_NEVER != next_ms)
+    {
+        ledpattern_arm(next_ms);
+    }
+}
+
+/*!
+* @brief Start the engine with every LED it owns off.
+* @note  Call from start-up code, after BSP_Init().
+*/
+void
+ledpattern_init (void)
+{
+    for (uint8_t i = 0; i <= LEDPAT_OWNED_LAST - LEDPAT_FIRST_LED; i++)
+    {
+        g_slots[i].pat = g_ledpat_off;
+
+        if (g_pins[i].b_port_e)
+        {
+            g_pe_mask |= (uint8_t)(1u << g_pins[i].bit);
+        }
+        else
+        {
+            g_pd_mask |= (uint8_t)(1u << g_pins[i].bit);
+        }
+    }
+
+    // One tick to put the LEDs out.
+    ledpattern_arm(0);
+}
+
+/*!
+* @brief Give an LED a new pattern, starting from the top of its cycle.
+* @param[in] led   LEDPAT_FIRST_LED to LEDPAT_LAST_LED.
+* @param[in] p_pat The pattern; copied.
+* @note  Takes effect at the next timer task period. LEDs owned by the
+*        task light are quietly ignored. Task context only.
+*/
+void
+ledpattern_set (uint8_t led, ledpat_t const * p_pat)
+{
+    ledpat_slot_t * p_slot;
+    uint32_t        now_ms = ledpattern_now_ms();
+    uint8_t         b_changed = 0;
+    CPU_SR_ALLOC();
+
+
+    assert((led >= LEDPAT_FIRST_LED) && (led <= LEDPAT_LAST_LED));
+    assert((LEDPAT_OFF == p_pat->kind) || (LEDPAT_ON == p_pat->kind) || (p_pat->period_ms > 0));
+
+    if (led > LEDPAT_OWNED_LAST)
+    {
+        return;
+    }
+
+    p_slot = &g_slots[led - LEDPAT_FIRST_LED];
+
+    CPU_CRITICAL_ENTER();
+    if ((p_slot->pat.kind != p_pat->kind) ||
+        (p_slot->pat.period_ms != p_pat->period_ms) ||
+        (p_slot->pat.on_ms != p_pat->on_ms))
+    {
+        p_slot->pat      = *p_pat;
+        p_slot->start_ms = now_ms;
+        p_slot->dither   = 0;
+        p_slot->gen++;
+        b_changed = 1;
+    }
+    CPU_CRITICAL_EXIT();
+
+    if (b_changed)
+    {
+        ledpattern_arm(0);
+    }
+}
+
+/*!
+* @brief Show a level as a bar of lit LEDs.
+* @param[in] first  The LED at the bottom of the bar.
+* @param[in] n_leds LEDs in the bar.
+* @param[in] n_lit  How many of them, from the bottom, to light.
+*/
+void
+ledpattern_bar (uint8_t first, uint8_t n_leds, uint8_t n_lit)
+{
+    static ledpat_t const on = { LEDPAT_ON, 0, 0 };
+
+
+    for (uint8_t i = 0; i < n_leds; i++)
+    {
+        ledpattern_set(first + i, (i < n_lit) ? &on : &g_ledpat_off);
+    }
+}
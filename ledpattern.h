@@ -0,0 +1,52 @@
+/** \file ledpattern.h
+*
+* @brief Timer-driven LED patterns.
+*
+* @par
+* COPYRIGHT NOTICE: (C) 2014 Barr Group, LLC.
+* All rights reserved.
+*/
+
+#ifndef _LEDPATTERN_H
+#define _LEDPATTERN_H
+
+#include <stdint.h>
+
+// The engine's update period while any LED is breathing. Breathing is
+// dithered at this rate, so a shorter period looks smoother but wakes the
+// CPU more often. Otherwise the engine runs only when some LED changes.
+#define LEDPAT_TICK_MS      20u
+
+// From ledpattern_next_ms(): the LED stays as it is.
+#define LEDPAT_NEVER        UINT32_MAX
+
+#define LEDPAT_FIRST_LED    4
+#define LEDPAT_LAST_LED     15
+
+typedef enum
+{
+    LEDPAT_OFF,
+    LEDPAT_ON,
+    LEDPAT_BLINK,               // Lit for on_ms of every period_ms.
+    LEDPAT_BREATHE              // Fades up and down once every period_ms.
+} ledpat_kind_t;
+
+typedef struct
+{
+    ledpat_kind_t  kind;
+    uint16_t       period_ms;
+    uint16_t       on_ms;
+} ledpat_t;
+
+extern ledpat_t const g_ledpat_off;
+extern ledpat_t const g_ledpat_health;      // Steady 3 Hz blink: still running.
+extern ledpat_t const g_ledpat_strobe;      // Short, fast flashes: act now.
+extern ledpat_t const g_ledpat_warn;        // Slow blink: take note.
+
+void    ledpattern_init(void);
+void    ledpattern_set(uint8_t led, ledpat_t const * p_pat);
+void    ledpattern_bar(uint8_t first, uint8_t n_leds, uint8_t n_lit);
+uint8_t ledpattern_render(ledpat_t const * p_pat, uint32_t t_ms, uint16_t * p_dither);
+uint32_t ledpattern_next_ms(ledpat_t const * p_pat, uint32_t t_ms);
+
+#endif /* _LEDPATTERN_H */
@@ -0,0 +1,94 @@
+/** \file ledpattern_render.c
+*
+* @brief The state of one LED at a point in its pattern, and how long it
+*        stays that way.
+*
+* Kept apart from the timer and port handling in ledpattern.c, with nothing
+* target specific, so that the pattern timing can be tested on the host.
+*
+* @par
+* COPYRIGHT NOTICE: (C) 2014 Barr Group, LLC.
+* All rights reserved.
+*/
+
+#include <stdint.h>
+
+#include "ledpattern.h"
+
+
+/*!
+* @brief Whether an LED is lit at a given point in its pattern.
+* @param[in]     p_pat    The pattern.
+* @param[in]     t_ms     Time since the pattern was set.
+* @param[in,out] p_dither Carried from one call to the next for BREATHE.
+* @return 1 if lit.
+* @note  Pure apart from *p_dither. A breathing LED is meant to be
+*        rendered every LEDPAT_TICK_MS.
+*/
+uint8_t
+ledpattern_render (ledpat_t const * p_pat, uint32_t t_ms, uint16_t * p_dither)
+{
+    uint32_t phase;
+    uint32_t ramp;
+    uint16_t duty;
+
+
+    switch (p_pat->kind)
+    {
+    case LEDPAT_ON:
+        return 1;
+
+    case LEDPAT_BLINK:
+        phase = t_ms % p_pat->period_ms;
+        return (phase < p_pat->on_ms);
+
+    case LEDPAT_BREATHE:
+        // A triangle from 0 to 256 and back, squared so that the fade
+        // looks even to the eye, sets the share of ticks that are lit.
+        phase = t_ms % p_pat->period_ms;
+        ramp  = (phase < p_pat->period_ms / 2) ? phase : (p_pat->period_ms - phase);
+        ramp  = (ramp * 512u) / p_pat->period_ms;
+        duty  = (uint16_t)((ramp * ramp) / 256u);
+
+        *p_dither += duty;
+        if (*p_dither >= 256u)
+        {
+            *p_dither -= 256u;
+            return 1;
+        }
+        return 0;
+
+    case LEDPAT_OFF:
+    default:
+        return 0;
+    }
+}
+
+/*!
+* @brief How long an LED keeps the state it has at a point in its pattern.
+* @param[in] p_pat The pattern.
+* @param[in] t_ms  Time since the pattern was set.
+* @return Milliseconds to the next change, never 0; LEDPAT_TICK_MS while
+*         breathing; or LEDPAT_NEVER for a steady LED.
+*/
+uint32_t
+ledpattern_next_ms (ledpat_t const * p_pat, uint32_t t_ms)
+{
+    uint32_t phase;
+
+
+    switch (p_pat->kind)
+    {
+    case LEDPAT_BLINK:
+        phase = t_ms % p_pat->period_ms;
+        return (phase < p_pat->on_ms) ? (p_pat->on_ms - phase) : (p_pat->period_ms - phase);
+
+    case LEDPAT_BREATHE:
+        return LEDPAT_TICK_MS;
+
+    case LEDPAT_ON:
+    case LEDPAT_OFF:
+    default:
+        return LEDPAT_NEVER;
+    }
+}
@@ -0,0 +1,166 @@
+/** \file mempool.c
+*
+* @brief Fixed-block memory pools.
+*
+* Each pool carves equal blocks out of the uC/LIB heap once, at start-up,
+* so the pools together can never use more than LIB_MEM_CFG_HEAP_SIZE.
+* Free blocks are kept on a singly linked list threaded through the blocks
+* themselves; getting and putting a block is O(1) and safe from ISRs.
+*
+* The kernel's own OS_MEM partitions (OS_CFG_MEM_EN) keep no usage
+* figures, which is why this exists.
+*
+* @par
+* COPYRIGHT NOTICE: (C) 2014 Barr Group, LLC.
+* All rights reserved.
+*/
+
+#include <assert.h>
+#include <stdint.h>
+
+#include "cpu.h"
+#include "lib_mem.h"
+
+#include "mempool.h"
+
+
+#define MEMPOOL_ALIGN       8u      // Enough for any message member.
+
+static mempool_t *  g_pools;        // Most recently created first.
+
+
+/*!
+* @brief Carve a pool of n_blks blocks out of the heap.
+* @param[out] p_pool   Pool to set up.
+* @param[in]  p_name   For diagnostics.
+* @param[in]  blk_size Bytes per block.
+* @param[in]  n_blks   Number of blocks.
+* @note  Call from start-up code, after Mem_Init().
+*/
+void
+mempool_create (mempool_t * p_pool, char const * p_name, uint16_t blk_size, uint16_t n_blks)
+{
+    uint8_t *   p_mem;
+    CPU_SIZE_T  bytes_reqd;
+    LIB_ERR     err;
+    CPU_SR_ALLOC();
+
+
+    // Every block must be able to hold the free-list link.
+    if (blk_size < sizeof(void *))
+    {
+        blk_size = sizeof(void *);
+    }
+    blk_size = (blk_size + MEMPOOL_ALIGN - 1) & ~(MEMPOOL_ALIGN - 1);
+
+    p_mem = (uint8_t *)Mem_HeapAlloc((CPU_SIZE_T)blk_size * n_blks, MEMPOOL_ALIGN, &bytes_reqd, &err);
+    assert(LIB_MEM_ERR_NONE == err);
+
+    p_pool->p_name     = p_name;
+    p_pool->p_free     = 0;
+    p_pool->blk_size   = blk_size;
+    p_pool->n_blks     = n_blks;
+    p_pool->n_free     = n_blks;
+    p_pool->n_free_min = n_blks;
+    p_pool->exhausted  = 0;
+
+    for (uint16_t i = n_blks; i > 0; i--)
+    {
+        void ** p_blk = (void **)(p_mem + (uint32_t)(i - 1) * blk_size);
+
+        *p_blk = p_pool->p_free;
+        p_pool->p_free = p_blk;
+    }
+
+    CPU_CRITICAL_ENTER();
+    p_pool->p_next = g_pools;
+    g_pools = p_pool;
+    CPU_CRITICAL_EXIT();
+}
+
+/*!
+* @brief Take a block.
+* @param[in,out] p_pool The pool.
+* @return The block, or NULL if the pool is empty.
+*/
+void *
+mempool_get (mempool_t * p_pool)
+{
+    void ** p_blk;
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+
+    p_blk = (void **)p_pool->p_free;
+    if (p_blk != 0)
+    {
+        p_pool->p_free = *p_blk;
+        p_pool->n_free--;
+        if (p_pool->n_free < p_pool->n_free_min)
+        {
+            p_pool->n_free_min = p_pool->n_free;
+        }
+    }
+    else
+    {
+        p_pool->exhausted++;
+    }
+
+    CPU_CRITICAL_EXIT();
+
+    return p_blk;
+}
+
+/*!
+* @brief Give a block back.
+* @param[in,out] p_pool The pool it came from.
+* @param[in]     p_blk  The block.
+*/
+void
+mempool_put (mempool_t * p_pool, void * p_blk)
+{
+    CPU_SR_ALLOC();
+
+
+    assert(p_blk != 0);
+
+    CPU_CRITICAL_ENTER();
+
+    assert(p_pool->n_free < p_pool->n_blks);
+    *(void **)p_blk = p_pool->p_free;
+    p_pool->p_free  = p_blk;
+    p_pool->n_free++;
+
+    CPU_CRITICAL_EXIT();
+}
+
+/*!
+* @brief Copy out the usage of every pool.
+* @param[out] p_stats Where to put one entry per pool.
+* @param[in]  max     Room in p_stats.
+* @return Number of entries filled in.
+*/
+uint8_t
+mempool_report (mempool_stats_t * p_stats, uint8_t max)
+{
+    uint8_t n = 0;
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+
+    for (mempool_t const * p_pool = g_pools; (p_pool != 0) && (n < max); p_pool = p_pool->p_next, n++)
+    {
+        p_stats[n].p_name    = p_pool->p_name;
+        p_stats[n].blk_size  = p_pool->blk_size;
+        p_stats[n].n_blks    = p_pool->n_blks;
+        p_stats[n].used      = p_pool->n_blks - p_pool->n_free;
+        p_stats[n].used_max  = p_pool->n_blks - p_pool->n_free_min;
+        p_stats[n].exhausted = p_pool->exhausted;
+    }
+
+    CPU_CRITICAL_EXIT();
+
+    return n;
+}
@@ -0,0 +1,43 @@
+/** \file mempool.h
+*
+* @brief Fixed-block memory pools.
+*
+* @par
+* COPYRIGHT NOTICE: (C) 2014 Barr Group, LLC.
+* All rights reserved.
+*/
+
+#ifndef _MEMPOOL_H
+#define _MEMPOOL_H
+
+#include <stdint.h>
+
+typedef struct mempool
+{
+    char const *      p_name;
+    void *            p_free;       // Free list, linked through the blocks.
+    uint16_t          blk_size;
+    uint16_t          n_blks;
+    uint16_t          n_free;
+    uint16_t          n_free_min;   // Low-water mark of n_free.
+    uint32_t          exhausted;    // Gets that found the pool empty.
+    struct mempool *  p_next;       // All pools, for reporting.
+} mempool_t;
+
+typedef struct
+{
+    char const *  p_name;
+    uint16_t      blk_size;
+    uint16_t      n_blks;
+    uint16_t      used;             // Blocks out now.
+    uint16_t      used_max;
+    uint32_t      exhausted;
+} mempool_stats_t;
+
+void    mempool_create(mempool_t * p_pool, char const * p_name,
+                       uint16_t blk_size, uint16_t n_blks);
+void *  mempool_get(mempool_t * p_pool);
+void    mempool_put(mempool_t * p_pool, void * p_blk);
+uint8_t mempool_report(mempool_stats_t * p_stats, uint8_t max);
+
+#endif /* _MEMPOOL_H */
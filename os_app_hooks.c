@@ -28,7 +28,14 @@
 
 #include <os.h>
 #include <os_app_hooks.h>
-#include <bsp_led.h>
+
+#include "cpuprof.h"
+#include "diag.h"
+#include "idle.h"
+#include "stkmon.h"
+#include "tasklight.h"
+#include "tickless.h"
+#include "trace.h"
 
 /*$PAGE*/
 /*
@@ -109,7 +116,7 @@ void  App_OS_ClrAllHooks (void)
 
 void  App_OS_TaskCreateHook (OS_TCB  *p_tcb)
 {
-    (void)&p_tcb;
+    stkmon_paint(p_tcb);
 }
 
 /*$PAGE*/
@@ -165,7 +172,13 @@ void  App_OS_TaskReturnHook (OS_TCB  *p_tcb)
 
 void  App_OS_IdleTaskHook (void)
 {
+    stkmon_scan();
 
+#if TICKLESS_EN > 0
+    tickless_idle();
+#else
+    idle_wait();
+#endif
 }
 
 /*$PAGE*/
@@ -224,26 +237,13 @@ void  App_OS_StatTaskHook (void)
 
 void  App_OS_TaskSwHook (void)
 {
-    OS_TCB  const * pTCBReady = OSTCBHighRdyPtr;
-	
-    if (pTCBReady != 0)
-    {
-        // Turn off all the user LEDs used for this purpose.
-        for (int i = 7; i <= 15; i++)
-        {
-	        BSP_LED_Off(i);
-	    }
-
-        // Copy the new task's priority.
-        CPU_INT08U priority = pTCBReady->Prio;
-	
-        // Turn on the user LED of matching priority.
-        // NOTE: LEDs 4-6 are reserved for other uses and idle prioirity is 15.
-	    if ((7 <= priority) && (priority <= 15))
-        {
-	        BSP_LED_On(priority);
-	    }
-    }
+#if CPUPROF_EN > 0
+    cpuprof_switch(OSTCBCurPtr);
+#endif
+    TRACE_SWITCH((OSTCBCurPtr != 0) ? OSTCBCurPtr->Prio : 0xFF, OSTCBHighRdyPtr->Prio);
+#if TASKLIGHT_EN > 0
+    tasklight_show(OSTCBHighRdyPtr);
+#endif
 }
 
 /*$PAGE*/
@@ -261,5 +261,10 @@ void  App_OS_TaskSwHook (void)
 
 void  App_OS_TimeTickHook (void)
 {
+    diag_tick_entry();
+    idle_wake_note(IDLE_WAKE_TICK);
 
+#if TICKLESS_EN > 0
+    tickless_tick_hook();
+#endif
 }
@@ -0,0 +1,161 @@
+/** \file periodic.c
+*
+* @brief Drift-free periodic task releases.
+*
+* A task that does its work and then delays for its period actually runs
+* at the period plus however long the work took. Here each release is an
+* absolute tick, one period after the previous release, so the work time
+* does not add up. A task that overruns into the next period loses that
+* release rather than being released late, keeping its phase, and the
+* loss is counted as a deadline miss.
+*
+* @par
+* COPYRIGHT NOTICE: (C) 2014 Barr Group, LLC.
+* All rights reserved.
+*/
+
+#include <assert.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "os.h"
+
+#include "sysclock.h"
+#include "periodic.h"
+
+
+/*!
+* @brief Set up a periodic release, with the first one period from now.
+* @param[out] p_periodic Release state, owned by the calling task.
+* @param[in]  p_name     For diagnostics.
+* @param[in]  period_ms  A whole number of ticks.
+*/
+void
+periodic_init (periodic_t * p_periodic, char const * p_name, uint32_t period_ms)
+{
+    OS_ERR err;
+
+
+    memset(p_periodic, 0, sizeof(*p_periodic));
+
+    p_periodic->p_name        = p_name;
+    p_periodic->period_us     = period_ms * 1000u;
+    p_periodic->period_ticks  = (period_ms * OS_CFG_TICK_RATE_HZ) / 1000u;
+    p_periodic->period_min_us = UINT32_MAX;
+    assert(p_periodic->period_ticks > 0);
+
+    p_periodic->next_release = OSTimeGet(&err);
+    assert(OS_ERR_NONE == err);
+
+    p_periodic->last_release_us = sysclock_us();
+}
+
+/*!
+* @brief Note a measured period in the histogram.
+*/
+static void
+periodic_histogram (periodic_t * p_periodic, uint32_t elapsed_us)
+{
+    int32_t  late_us = (int32_t)(elapsed_us - p_periodic->period_us);
+    int32_t  bin;
+
+
+    if (late_us >= 0)
+    {
+        bin = (late_us + PERIODIC_HIST_BIN_US / 2) / PERIODIC_HIST_BIN_US;
+    }
+    else
+    {
+        bin = -((-late_us + PERIODIC_HIST_BIN_US / 2) / PERIODIC_HIST_BIN_US);
+    }
+
+    bin += PERIODIC_HIST_BINS / 2;
+    if (bin < 0)
+    {
+        bin = 0;
+    }
+    else if (bin >= PERIODIC_HIST_BINS)
+    {
+        bin = PERIODIC_HIST_BINS - 1;
+    }
+
+    p_periodic->hist[bin]++;
+}
+
+/*!
+* @brief Work out the next release, counting any that were overrun.
+* @param[in,out] p_periodic Release state.
+* @return The tick of the next release, 1 to period_ticks from now.
+*/
+OS_TICK
+periodic_next (periodic_t * p_periodic)
+{
+    OS_ERR    err;
+    OS_TICK   now;
+    OS_TICK   next;
+
+
+    now  = OSTimeGet(&err);
+    assert(OS_ERR_NONE == err);
+
+    next = p_periodic->next_release + p_periodic->period_ticks;
+
+    // Unless the next release is still ahead (1 to period ticks away) the
+    // work overran it; skip to the first one that is.
+    while ((OS_TICK)(next - now - 1) >= p_periodic->period_ticks)
+    {
+        next += p_periodic->period_ticks;
+        p_periodic->misses++;
+    }
+    p_periodic->next_release = next;
+
+    return next;
+}
+
+/*!
+* @brief Account for a release that has just happened.
+* @param[in,out] p_periodic Release state.
+* @return Microseconds since the previous release.
+*/
+uint32_t
+periodic_released (periodic_t * p_periodic)
+{
+    uint64_t  now_us;
+    uint32_t  elapsed_us;
+
+
+    now_us     = sysclock_us();
+    elapsed_us = (uint32_t)(now_us - p_periodic->last_release_us);
+    p_periodic->last_release_us = now_us;
+
+    p_periodic->releases++;
+    if (elapsed_us < p_periodic->period_min_us)
+    {
+        p_periodic->period_min_us = elapsed_us;
+    }
+    if (elapsed_us > p_periodic->period_max_us)
+    {
+        p_periodic->period_max_us = elapsed_us;
+    }
+    periodic_histogram(p_periodic, elapsed_us);
+
+    return elapsed_us;
+}
+
+/*!
+* @brief Sleep until the next release.
+* @param[in,out] p_periodic Release state.
+* @return Microseconds since the previous release.
+*/
+uint32_t
+periodic_wait (periodic_t * p_periodic)
+{
+    OS_ERR err;
+
+
+    // A tick may pass after periodic_next(), making this an immediate release.
+    OSTimeDly(periodic_next(p_periodic), OS_OPT_TIME_MATCH, &err);
+    assert((OS_ERR_NONE == err) || (OS_ERR_TIME_ZERO_DLY == err));
+
+    return periodic_released(p_periodic);
+}
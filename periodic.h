@@ -0,0 +1,45 @@
+/** \file periodic.h
+*
+* @brief Drift-free periodic task releases.
+*
+* @par
+* COPYRIGHT NOTICE: (C) 2014 Barr Group, LLC.
+* All rights reserved.
+*/
+
+#ifndef _PERIODIC_H
+#define _PERIODIC_H
+
+#include <stdint.h>
+
+#include "os.h"
+
+// Histogram of measured periods: the middle bin is on time, each bin to
+// either side is PERIODIC_HIST_BIN_US later or earlier, and the end bins
+// catch everything beyond.
+#define PERIODIC_HIST_BINS      9
+#define PERIODIC_HIST_BIN_US    500
+
+typedef struct
+{
+    char const *  p_name;
+    uint32_t      period_us;
+    OS_TICK       period_ticks;
+    OS_TICK       next_release;         // Tick of the next release.
+    uint64_t      last_release_us;
+
+    uint32_t      releases;
+    uint32_t      misses;               // Releases lost to overruns.
+    uint32_t      period_min_us;
+    uint32_t      period_max_us;
+    uint32_t      hist[PERIODIC_HIST_BINS];
+} periodic_t;
+
+void     periodic_init(periodic_t * p_periodic, char const * p_name, uint32_t period_ms);
+uint32_t periodic_wait(periodic_t * p_periodic);
+
+// periodic_wait() in two halves, for callers that wait some other way.
+OS_TICK  periodic_next(periodic_t * p_periodic);
+uint32_t periodic_released(periodic_t * p_periodic);
+
+#endif /* _PERIODIC_H */
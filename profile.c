@@ -0,0 +1,171 @@
+/** \file profile.c
+*
+* @brief Scrolling depth-profile graph.
+*
+* Samples are kept in a ring with one slot per LCD column, and the plot
+* sweeps across the screen like an oscilloscope trace: each new sample is
+* drawn in its own column and the column after it is blanked as a cursor.
+* So a normal update touches two columns. The whole plot is only redrawn
+* when it is first shown or when the depth scale has to change.
+*
+* The sweep is used instead of shifting the plot one column per sample
+* on purpose. A shift moves every column, so each sample would rewrite
+* the whole graph area (7 pages by 128 columns) over the SPI bus, instead
+* of the two columns the sweep rewrites. The cursor marks the newest sample.
+*
+* @par
+* COPYRIGHT NOTICE: (C) 2014 Barr Group, LLC.
+* All rights reserved.
+*/
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "lcd_fb.h"
+#include "profile.h"
+
+
+#define PROFILE_COLS        LCD_WIDTH
+#define PROFILE_FIRST_PAGE  1                   // Page 0 is the header.
+#define PROFILE_PAGES       (LCD_PAGES - PROFILE_FIRST_PAGE)
+#define PROFILE_HEIGHT      (PROFILE_PAGES * 8)
+
+// Full-scale depths to choose from, in meters.
+static uint8_t const g_scales_m[] = { 10, 20, 30, 40, 60, 80, 120, 200 };
+
+// Depth per column, in decimeters; slot n is drawn in column n.
+static uint16_t  g_depth_dm[PROFILE_COLS];
+
+static uint32_t  g_samples;         // Samples taken since reset.
+static uint32_t  g_drawn;           // Samples already on the LCD.
+static uint8_t   g_scale;           // Index into g_scales_m.
+static uint8_t   gb_rescaled;        // Scale changed since the last draw.
+
+
+static uint8_t
+profile_pick_scale (void)
+{
+    uint16_t max_dm = 0;
+    uint8_t  scale = 0;
+
+    for (uint8_t col = 0; col < PROFILE_COLS; col++)
+    {
+        if (g_depth_dm[col] > max_dm)
+        {
+            max_dm = g_depth_dm[col];
+        }
+    }
+
+    while ((scale + 1 < sizeof(g_scales_m)) && (max_dm > g_scales_m[scale] * 10u))
+    {
+        ++scale;
+    }
+
+    return scale;
+}
+
+/*!
+* @brief Record one depth sample; call every PROFILE_SAMPLE_S of dive time.
+* @param[in] depth_mm Current depth.
+*/
+void
+profile_sample (int32_t depth_mm)
+{
+    uint8_t scale;
+
+    if (depth_mm < 0)
+    {
+        depth_mm = 0;
+    }
+
+    g_depth_dm[g_samples % PROFILE_COLS] = (uint16_t)(depth_mm / 100);
+    ++g_samples;
+
+    // The sample that scrolled off may have been the deepest, too.
+    scale = profile_pick_scale();
+    if (scale != g_scale)
+    {
+        g_scale = scale;
+        gb_rescaled = 1;
+    }
+}
+
+/*!
+* @brief Draw one column: filled from the surface down to the depth.
+*/
+static void
+profile_draw_column (uint8_t col, uint16_t depth_dm)
+{
+    uint32_t height = ((uint32_t)depth_dm * PROFILE_HEIGHT) / (g_scales_m[g_scale] * 10u);
+
+    if (height > PROFILE_HEIGHT)
+    {
+        height = PROFILE_HEIGHT;
+    }
+
+    for (uint8_t page = 0; page < PROFILE_PAGES; page++)
+    {
+        uint8_t  top = page * 8;
+        uint8_t  bits;
+
+        if (height >= top + 8u)
+        {
+            bits = 0xFF;
+        }
+        else if (height <= top)
+        {
+            bits = 0x00;
+        }
+        else
+        {
+            bits = (uint8_t)((1u << (height - top)) - 1u);
+        }
+
+        lcd_fb_write(PROFILE_FIRST_PAGE + page, col, &bits, 1);
+    }
+}
+
+static void
+profile_draw_cursor (uint8_t col)
+{
+    profile_draw_column((col + 1) % PROFILE_COLS, 0);
+}
+
+/*!
+* @brief Bring the graph on the LCD up to date.
+* @param[in] b_full Redraw everything, e.g. when the page is first shown.
+*/
+void
+profile_draw (uint8_t b_full)
+{
+    char  header[LCD_WIDTH / LCD_FONT_WIDTH + 1];
+
+    // A lap of the ring behind is no cheaper than starting over.
+    if (b_full || gb_rescaled || (g_samples - g_drawn > PROFILE_COLS))
+    {
+        snprintf(header, sizeof(header), "PROFILE  0-%uM", g_scales_m[g_scale]);
+        lcd_fb_string(0, header);
+
+        for (uint8_t col = 0; col < PROFILE_COLS; col++)
+        {
+            profile_draw_column(col, (col < g_samples) ? g_depth_dm[col] : 0);
+        }
+        if (g_samples)
+        {
+            profile_draw_cursor((g_samples - 1) % PROFILE_COLS);
+        }
+
+        gb_rescaled = 0;
+        g_drawn = g_samples;
+        return;
+    }
+
+    while (g_drawn < g_samples)
+    {
+        uint8_t col = g_drawn % PROFILE_COLS;
+
+        profile_draw_column(col, g_depth_dm[col]);
+        profile_draw_cursor(col);
+        ++g_drawn;
+    }
+}
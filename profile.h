@@ -0,0 +1,20 @@
+/** \file profile.h
+*
+* @brief Scrolling depth-profile graph.
+*
+* @par
+* COPYRIGHT NOTICE: (C) 2014 Barr Group, LLC.
+* All rights reserved.
+*/
+
+#ifndef _PROFILE_H
+#define _PROFILE_H
+
+#include <stdint.h>
+
+#define PROFILE_SAMPLE_S    10      // Seconds of dive time per column.
+
+void profile_sample(int32_t depth_mm);
+void profile_draw(uint8_t b_full);
+
+#endif /* _PROFILE_H */
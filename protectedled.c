@@ -2,6 +2,14 @@
 *
 * @brief Reentrant LED driver.
 *
+* Changing an LED is one read-modify-write of a port register, so it is
+* protected by disabling interrupts for those few instructions rather than
+* by a kernel mutex. That also makes the driver safe to call from timer
+* callbacks and interrupt handlers. The mutex version is kept, under
+* PROTECTEDLED_MUTEX_EN, to compare the two with protectedLED_stats_get(),
+* which PROTECTEDLED_STATS_EN builds in. Timing a call costs more than the
+* call, so the figures are left out otherwise.
+*
 * @par
 * COPYRIGHT NOTICE: (c) 2014 Barr Group, LLC.
 * All rights reserved.
@@ -10,15 +18,22 @@
 #include <assert.h>
 #include <stdint.h>
 #include  "cpu.h"
-#include  "bsp_led.h"
+#include  "cpu_core.h"
 
 #include "os.h"
+#include "iorx63n.h"
 
 #include "protectedled.h"								
 
 
+#if PROTECTEDLED_MUTEX_EN
 // Private mutex.
 static OS_MUTEX  g_led_mutex;    	
+#endif
+
+#if PROTECTEDLED_STATS_EN
+static protectedled_stats_t  g_stats;
+#endif
 
 
 /*!
@@ -27,33 +42,118 @@ static OS_MUTEX  g_led_mutex;
 void
 protectedLED_Init (void)
 {
+#if PROTECTEDLED_MUTEX_EN
     OS_ERR err;
 
    // Create the mutex that protects the hardware from race conditions.
    OSMutexCreate(&g_led_mutex, "LED Mutex", &err);
    assert(OS_ERR_NONE == err);
+#endif
 }
 
+#if PROTECTEDLED_STATS_EN
 /*!
-* @brief Toggle one or all user LEDs, safely.
-* @param[in] led The LED number, or 0 for all.
+* @brief Account for the cost of one call.
+* @param[in] start Timestamp taken on entry.
+*/
+static void
+protectedLED_cost (CPU_TS32 start)
+{
+    CPU_TS32 cost = CPU_TS_Get32() - start;
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    g_stats.calls++;
+    g_stats.cost_total_ts += cost;
+    if (cost > g_stats.cost_max_ts)
+    {
+        g_stats.cost_max_ts = cost;
+    }
+    CPU_CRITICAL_EXIT();
+}
+#endif /* PROTECTEDLED_STATS_EN */
+
+/*!
+* @brief Set several user LEDs on ports D and E in one go, safely.
+* @param[in] pd_mask Port D bits to change.
+* @param[in] pd      Their new values (the LEDs are active low).
+* @param[in] pe_mask Port E bits to change.
+* @param[in] pe      Their new values.
+* @note  The task light writes the same ports from the context switch hook,
+*        so both writes are made with interrupts disabled. The mutex
+*        version does not guard against that, and must not be called from
+*        an interrupt handler.
 */
 void
-protectedLED_Toggle (uint8_t led)
+protectedLED_Write (uint8_t pd_mask, uint8_t pd, uint8_t pe_mask, uint8_t pe)
 {
+#if PROTECTEDLED_STATS_EN
+    CPU_TS32 start = CPU_TS_Get32();
+#endif
+
+#if PROTECTEDLED_MUTEX_EN
     OS_ERR   err;
-	
+
 
     // Try to acquire the mutex.
     OSMutexPend(&g_led_mutex, 0, OS_OPT_PEND_BLOCKING, 0, &err);
-	assert(OS_ERR_NONE == err);
-    {
-        // Safely inside the critical section.
+    assert(OS_ERR_NONE == err);
+
+    PORTD.PODR.BYTE = (PORTD.PODR.BYTE & ~pd_mask) | (pd & pd_mask);
+    PORTE.PODR.BYTE = (PORTE.PODR.BYTE & ~pe_mask) | (pe & pe_mask);
 
-        // Call the non-reentrant driver.
-        BSP_LED_Toggle(led);
-    }
     // Release the mutex.
     OSMutexPost(&g_led_mutex, OS_OPT_POST_NONE, &err);
-	assert(OS_ERR_NONE == err);
+    assert(OS_ERR_NONE == err);
+#else
+    CPU_SR_ALLOC();
+
+
+    // Nothing else can touch the ports between the read and the write.
+    CPU_CRITICAL_ENTER();
+    PORTD.PODR.BYTE = (PORTD.PODR.BYTE & ~pd_mask) | (pd & pd_mask);
+    PORTE.PODR.BYTE = (PORTE.PODR.BYTE & ~pe_mask) | (pe & pe_mask);
+    CPU_CRITICAL_EXIT();
+#endif
+
+#if PROTECTEDLED_STATS_EN
+    protectedLED_cost(start);
+#endif
+}
+
+#if PROTECTEDLED_STATS_EN
+/*!
+* @brief Copy out the per-call cost figures.
+* @param[out] p_stats Where to put them.
+*/
+void
+protectedLED_stats_get (protectedled_stats_t * p_stats)
+{
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    *p_stats = g_stats;
+    CPU_CRITICAL_EXIT();
+}
+
+/*!
+* @brief Average cost of one call.
+* @return Microseconds, or 0 before the first call.
+*/
+uint32_t
+protectedLED_cost_avg_us (void)
+{
+    protectedled_stats_t stats;
+
+    protectedLED_stats_get(&stats);
+
+    if (0 == stats.calls)
+    {
+        return 0;
+    }
+
+    return (uint32_t)CPU_TS32_to_uSec((CPU_TS32)(stats.cost_total_ts / stats.calls));
 }
+#endif /* PROTECTEDLED_STATS_EN */
@@ -10,7 +10,28 @@
 #ifndef _PROTECTEDLED_H
 #define _PROTECTEDLED_H
 
+#include <stdint.h>
+
+#include "cpu.h"
+
+// 1: serialize with an OS mutex, as before; for comparing costs only.
+#define PROTECTEDLED_MUTEX_EN   0
+
+// 1: time every call, for protectedLED_stats_get().
+#define PROTECTEDLED_STATS_EN   0
+
+typedef struct
+{
+    uint32_t  calls;
+    CPU_TS32  cost_max_ts;
+    uint64_t  cost_total_ts;
+} protectedled_stats_t;
+
 void protectedLED_Init(void);
-void protectedLED_Toggle(uint8_t led);
+void protectedLED_Write(uint8_t pd_mask, uint8_t pd, uint8_t pe_mask, uint8_t pe);
+#if PROTECTEDLED_STATS_EN
+void protectedLED_stats_get(protectedled_stats_t * p_stats);
+uint32_t protectedLED_cost_avg_us(void);
+#endif
 
 #endif  /* _PROTECTEDLED_H */
@@ -14,10 +14,78 @@
 #include "iorx63n.h"
 
 #include "pushbutton.h"	
+#include "mempool.h"
+#include "sysclock.h"
+#include "trace.h"
+#include "watchdog.h"
+
+#define BUTTON_POLL_MS      50
+
+#define BUTTON_Q_SIZE       4
+
+// At most every queue entry, the event the calculator is handling and the
+// one the debouncer is posting are out at once. 16 bytes each.
+#define BUTTON_POOL_BLKS    (BUTTON_Q_SIZE + 2)
 
 // Global definitions
-OS_SEM          g_sw1_sem;
-OS_SEM          g_sw2_sem;
+OS_Q            g_button_q;
+
+// Button events travel by pointer; the receiver owns them until released.
+static mempool_t  g_button_pool;
+
+
+/*!
+* @brief Create the button event queue and its block pool.
+*/
+void
+pushbutton_init (void)
+{
+    OS_ERR err;
+
+    OSQCreate(&g_button_q, "Buttons", BUTTON_Q_SIZE, &err);
+    assert(OS_ERR_NONE == err);
+
+    mempool_create(&g_button_pool, "Button Events", sizeof(button_event_t), BUTTON_POOL_BLKS);
+}
+
+/*!
+* @brief Return a button event taken from g_button_q.
+* @param[in] p_event The event.
+*/
+void
+button_release (button_event_t * p_event)
+{
+    mempool_put(&g_button_pool, p_event);
+}
+
+/*!
+* @brief Report a debounced press.
+* @note  Presses are dropped, not queued up, if the receiver falls behind.
+*/
+static void
+button_post (uint8_t button)
+{
+    OS_ERR           err;
+    button_event_t * p_event = (button_event_t *)mempool_get(&g_button_pool);
+
+
+    if (0 == p_event)
+    {
+        // Counted by the pool as an exhaustion.
+        return;
+    }
+
+    p_event->button  = button;
+    p_event->time_us = sysclock_us();
+
+    OSQPost(&g_button_q, p_event, sizeof(*p_event), OS_OPT_POST_FIFO, &err);
+    TRACE_Q_POST(&g_button_q, err);
+    if (OS_ERR_NONE != err)
+    {
+        assert(OS_ERR_Q_MAX == err);
+        button_release(p_event);
+    }
+}
 
 
 /*!
@@ -35,19 +103,24 @@ debounce_task (void * p_arg)
     uint8_t	    b_sw2_curr = 1;
     uint8_t     b_sw2_prev = 1;
     uint8_t     b_sw2_retriggered = 1;
+    uint16_t    sw2_held_ms = 0;
 
     OS_ERR      err;
+    uint8_t     wd_id;
 
 
     (void)p_arg;    // NOTE: Silence compiler warning about unused param.
 
+    wd_id = watchdog_register("Button Debouncer", 250);
+
     // Configure GPIO Port4 as an input.
     PORT4.PDR.BYTE = 0;
 
     for (;;)
     {
         // Delay for 50 ms.
-	OSTimeDlyHMSM(0, 0, 0, 50, OS_OPT_TIME_HMSM_STRICT, &err);
+	OSTimeDlyHMSM(0, 0, 0, BUTTON_POLL_MS, OS_OPT_TIME_HMSM_STRICT, &err);
+        watchdog_beat(wd_id);
 	
         // Read the current state of the buttons.
         uint8_t raw = PORT4.PIDR.BYTE;
@@ -59,8 +132,7 @@ debounce_task (void * p_arg)
 	if ((0 == b_sw1_curr) && (0 == b_sw1_prev))
         {
             // Signal that SW1 has been pressed (or is still held down).
-	    OSSemPost(&g_sw1_sem, OS_OPT_POST_1, &err);
-	    assert(OS_ERR_NONE == err);
+	    button_post(BUTTON_SW1);
 	}
 
         // Save current SW1 state for next cycle.
@@ -74,17 +146,25 @@ debounce_task (void * p_arg)
         {
             if (b_sw2_retriggered)
             {
-                // Signal that SW2 has been pressed.
-	        OSSemPost(&g_sw2_sem, OS_OPT_POST_1, &err);
-	        assert(OS_ERR_NONE == err);
-
-                // Do not allow repeats while held down.
-                b_sw2_retriggered = 0;
+                sw2_held_ms += BUTTON_POLL_MS;
+                if (sw2_held_ms >= BUTTON_LONG_MS)
+                {
+                    // Signal a long press, once, while still held down.
+                    button_post(BUTTON_SW2_LONG);
+                    b_sw2_retriggered = 0;
+                }
             }
         }
         else
         {
-            // Button released; reset trigger.
+            // Button released: anything short of a long press is a press.
+            if (b_sw2_retriggered && (sw2_held_ms > 0))
+            {
+                button_post(BUTTON_SW2);
+            }
+
+            // Reset trigger.
+            sw2_held_ms = 0;
             b_sw2_retriggered = 1;
 	}
 
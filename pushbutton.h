@@ -10,9 +10,30 @@
 #ifndef _PUSHBUTTON_H
 #define _PUSHBUTTON_H
 
-extern OS_SEM g_sw1_sem;
-extern OS_SEM g_sw2_sem;
+#include <stdint.h>
 
+#include "os.h"
+
+#define BUTTON_SW1      1
+#define BUTTON_SW2      2
+#define BUTTON_SW2_LONG 3       // SW2 held down for BUTTON_LONG_MS.
+
+// SW2 held this long is a long press, posted as soon as it is reached. A
+// shorter press is posted when SW2 is let go.
+#define BUTTON_LONG_MS  2000u
+
+// A debounced press, as posted to g_button_q.
+typedef struct
+{
+    uint8_t   button;           // BUTTON_SW1, BUTTON_SW2 or BUTTON_SW2_LONG.
+    uint64_t  time_us;
+} button_event_t;
+
+// Receives a button_event_t pointer per press; return it with button_release().
+extern OS_Q g_button_q;
+
+void  pushbutton_init(void);
+void  button_release(button_event_t * p_event);
 void  debounce_task(void * p_arg);
 
 #endif /* _PUSHBUTTON_H */
@@ -0,0 +1,178 @@
+/** \file stkmon.c
+*
+* @brief Task stack high-water marks.
+*
+* Each task's stack is filled with a known pattern when it is created, from
+* below the initial register frame down to the base. The idle task then
+* walks up from the base of each stack a few words at a time, looking for
+* the lowest word that no longer holds the pattern; everything from there
+* up has been used at some point.
+*
+* Only tasks created after App_OS_SetAllHooks() are covered. The kernel's
+* own idle, tick and timer tasks are created inside OSInit().
+*
+* @par
+* COPYRIGHT NOTICE: (C) 2014 Barr Group, LLC.
+* All rights reserved.
+*/
+
+#include <stdint.h>
+
+#include "cpu.h"
+#include "os.h"
+
+#include "stkmon.h"
+
+
+#define STKMON_PATTERN      0xA5A5A5A5uL
+
+typedef struct
+{
+    OS_TCB const *  p_tcb;
+    CPU_STK      *  p_base;
+    uint16_t        size;
+    uint16_t        free;       // Untouched words at the base, as last found.
+    uint16_t        free_min;   // Lowest free over every run of the task.
+    uint16_t        cursor;     // Next word to check.
+} stkmon_slot_t;
+
+static stkmon_slot_t  g_slots[STKMON_MAX_TASKS];
+static uint8_t        g_n_slots;
+static uint8_t        g_scan_slot;
+
+
+/*!
+* @brief Fill the unused part of a new task's stack with the pattern.
+* @param[in] p_tcb The task being created.
+* @note  Called from App_OS_TaskCreateHook(), before the task first runs.
+*        A task created again with the same TCB keeps its worst case.
+*/
+void
+stkmon_paint (OS_TCB * p_tcb)
+{
+    CPU_STK       * p_base  = p_tcb->StkBasePtr;
+    uint16_t        painted = (uint16_t)(p_tcb->StkPtr - p_base);
+    stkmon_slot_t * p_slot  = 0;
+    uint8_t         i;
+    CPU_SR_ALLOC();
+
+
+    for (uint16_t word = 0; word < painted; word++)
+    {
+        p_base[word] = STKMON_PATTERN;
+    }
+
+    CPU_CRITICAL_ENTER();
+
+    for (i = 0; i < g_n_slots; i++)
+    {
+        if (g_slots[i].p_tcb == p_tcb)
+        {
+            p_slot = &g_slots[i];
+            break;
+        }
+    }
+
+    if ((0 == p_slot) && (g_n_slots < STKMON_MAX_TASKS))
+    {
+        p_slot = &g_slots[g_n_slots++];
+        p_slot->p_tcb    = p_tcb;
+        p_slot->free_min = painted;
+    }
+
+    if (p_slot != 0)
+    {
+        p_slot->p_base = p_base;
+        p_slot->size   = (uint16_t)p_tcb->StkSize;
+        p_slot->free   = painted;
+        p_slot->cursor = 0;
+    }
+
+    CPU_CRITICAL_EXIT();
+}
+
+/*!
+* @brief Move on to the next stack.
+*/
+static void
+stkmon_next (stkmon_slot_t * p_slot)
+{
+    p_slot->cursor = 0;
+
+    if (++g_scan_slot >= g_n_slots)
+    {
+        g_scan_slot = 0;
+    }
+}
+
+/*!
+* @brief Check the next few words of one stack.
+* @note  Called from the idle task hook; bounded by STKMON_WORDS_PER_PASS.
+*/
+void
+stkmon_scan (void)
+{
+    stkmon_slot_t * p_slot;
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+
+    if (g_n_slots > 0)
+    {
+        p_slot = &g_slots[g_scan_slot];
+
+        for (uint8_t n = 0; n < STKMON_WORDS_PER_PASS; n++)
+        {
+            if (p_slot->cursor >= p_slot->free)
+            {
+                // No deeper than last time.
+                stkmon_next(p_slot);
+                break;
+            }
+
+            if (p_slot->p_base[p_slot->cursor] != STKMON_PATTERN)
+            {
+                p_slot->free = p_slot->cursor;
+                if (p_slot->free < p_slot->free_min)
+                {
+                    p_slot->free_min = p_slot->free;
+                }
+                stkmon_next(p_slot);
+                break;
+            }
+
+            p_slot->cursor++;
+        }
+    }
+
+    CPU_CRITICAL_EXIT();
+}
+
+/*!
+* @brief Copy out each task's stack size and deepest use.
+* @param[out] p_entries Where to put one entry per task.
+* @param[in]  max       Room in p_entries.
+* @return Number of entries filled in.
+*/
+uint8_t
+stkmon_get (stkmon_entry_t * p_entries, uint8_t max)
+{
+    uint8_t n;
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+
+    n = (g_n_slots < max) ? g_n_slots : max;
+    for (uint8_t i = 0; i < n; i++)
+    {
+        p_entries[i].p_name   = (char const *)g_slots[i].p_tcb->NamePtr;
+        p_entries[i].size     = g_slots[i].size;
+        p_entries[i].used_max = g_slots[i].size - g_slots[i].free_min;
+    }
+
+    CPU_CRITICAL_EXIT();
+
+    return n;
+}
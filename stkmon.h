@@ -0,0 +1,31 @@
+/** \file stkmon.h
+*
+* @brief Task stack high-water marks.
+*
+* @par
+* COPYRIGHT NOTICE: (C) 2014 Barr Group, LLC.
+* All rights reserved.
+*/
+
+#ifndef _STKMON_H
+#define _STKMON_H
+
+#include <stdint.h>
+
+#include "os.h"
+
+#define STKMON_MAX_TASKS        10
+#define STKMON_WORDS_PER_PASS    8      // Stack words checked per idle pass.
+
+typedef struct
+{
+    char const *  p_name;
+    uint16_t      size;         // Words.
+    uint16_t      used_max;     // Deepest use seen, in words.
+} stkmon_entry_t;
+
+void    stkmon_paint(OS_TCB * p_tcb);
+void    stkmon_scan(void);
+uint8_t stkmon_get(stkmon_entry_t * p_entries, uint8_t max);
+
+#endif /* _STKMON_H */
@@ -0,0 +1,169 @@
+/** \file sysclock.c
+*
+* @brief 64-bit monotonic microsecond clock.
+*
+* CMT1 free-runs from PCLK / 32 and wraps every 65536 counts (about 44 ms).
+* Its compare-match interrupt counts the wraps, and the two are combined
+* into a 64-bit count on every read. This is the one timestamp source for
+* the application; the uC/OS-III tick and the 16-bit CPU_TS timer are not
+* used for measuring time.
+*
+* On a host build the clock is backed by clock_gettime() instead.
+*
+* @par
+* COPYRIGHT NOTICE: (C) 2014 Barr Group, LLC.
+* All rights reserved.
+*/
+
+#include <stdint.h>
+
+#include "sysclock.h"
+#include "idle.h"
+
+#ifdef __ICCRX__
+
+#include "iorx63n.h"
+
+
+#define SYSCLOCK_PCLK_HZ    48000000uL
+#define SYSCLOCK_DIV        32u
+#define SYSCLOCK_HZ         (SYSCLOCK_PCLK_HZ / SYSCLOCK_DIV)     // 1.5 MHz
+
+// Counts to microseconds, as a reduced fraction of 1000000 / SYSCLOCK_HZ,
+// so that the 64-bit product cannot overflow in practice.
+#define SYSCLOCK_US_MUL     2u
+#define SYSCLOCK_US_DIV     3u
+
+#if ((0x10000uL * SYSCLOCK_US_MUL) / SYSCLOCK_US_DIV) != SYSCLOCK_WRAP_US
+#error "SYSCLOCK_WRAP_US does not match the CMT1 divider"
+#endif
+
+#define CMCR_CKS_DIV32      0x0001u
+#define CMCR_CMIE           0x0040u
+
+// CMI1 is vector 29. It sits above CPU_CFG_KA_IPL_BOUNDARY, so it is not
+// kernel aware, but it is never held off by a kernel critical section.
+#define VECT_CMT1_CMI1      29
+#define SYSCLOCK_IPL        13
+
+static uint8_t volatile * const p_IR_cmi1  = (uint8_t *)(0x00087000 + VECT_CMT1_CMI1);
+static uint8_t volatile * const p_IER_cmi1 = (uint8_t *)(0x00087200 + VECT_CMT1_CMI1 / 8);
+static uint8_t volatile * const p_IPR_cmi1 = (uint8_t *)0x00087305;     // IPR005
+
+// Number of times CMT1 has wrapped.
+static volatile uint32_t  g_wraps;
+
+
+/*!
+* @brief Start CMT1 free-running and unmask its wrap interrupt.
+*/
+void
+sysclock_init (void)
+{
+    /* Protection off */
+    SYSTEM.PRCR.WORD = 0xA503u;
+
+    // Cancel the CMT0/CMT1 module stop.
+    SYSTEM.MSTPCRA.BIT.MSTPA15 = 0;
+
+    /* Protection on */
+    SYSTEM.PRCR.WORD = 0xA500u;
+
+    CMT.CMSTR0.BIT.STR1 = 0;
+    CMT1.CMCR.WORD = CMCR_CKS_DIV32 | CMCR_CMIE;
+    CMT1.CMCOR = 0xFFFFu;
+    CMT1.CMCNT = 0;
+
+    *p_IPR_cmi1  = SYSCLOCK_IPL;
+    *p_IER_cmi1 |= (1u << (VECT_CMT1_CMI1 % 8));
+
+    CMT.CMSTR0.BIT.STR1 = 1;
+}
+
+/*!
+* @brief Current time since sysclock_init(), in microseconds.
+* @note  Lock free; safe from tasks and from any ISR at or below SYSCLOCK_IPL.
+*/
+uint64_t
+sysclock_us (void)
+{
+    uint32_t wraps;
+    uint16_t count;
+    uint8_t  b_pending;
+
+    do
+    {
+        wraps = g_wraps;
+        count = CMT1.CMCNT;
+
+        // A wrap that has happened but not been counted yet, because the
+        // caller has interrupts masked. Re-read so count is after it.
+        b_pending = *p_IR_cmi1;
+        if (b_pending)
+        {
+            count = CMT1.CMCNT;
+        }
+
+        // If sysclock_isr() ran in the meantime, just try again.
+    } while (wraps != g_wraps);
+
+    if (b_pending)
+    {
+        ++wraps;
+    }
+
+    return ((((uint64_t)wraps << 16) | count) * SYSCLOCK_US_MUL) / SYSCLOCK_US_DIV;
+}
+
+/*!
+*
+* @brief CMT1 Compare Match (Wrap) Interrupt Handler
+*/
+__interrupt void
+sysclock_isr (void)
+{
+    ++g_wraps;
+
+    idle_wake_note(IDLE_WAKE_SYSCLOCK);
+}
+
+#else /* Host build */
+
+#include <time.h>
+
+
+static uint64_t  g_epoch_us;
+
+
+static uint64_t
+sysclock_host_us (void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t)ts.tv_sec * 1000000u) + ((uint64_t)ts.tv_nsec / 1000u);
+}
+
+void
+sysclock_init (void)
+{
+    g_epoch_us = sysclock_host_us();
+}
+
+uint64_t
+sysclock_us (void)
+{
+    return sysclock_host_us() - g_epoch_us;
+}
+
+#endif /* __ICCRX__ */
+
+/*!
+* @brief Current time since sysclock_init(), in milliseconds.
+* @note  Wraps after 49 days; compare with unsigned subtraction.
+*/
+uint32_t
+sysclock_ms (void)
+{
+    return (uint32_t)(sysclock_us() / 1000u);
+}
@@ -0,0 +1,26 @@
+/** \file sysclock.h
+*
+* @brief 64-bit monotonic microsecond clock.
+*
+* @par
+* COPYRIGHT NOTICE: (C) 2014 Barr Group, LLC.
+* All rights reserved.
+*/
+
+#ifndef _SYSCLOCK_H
+#define _SYSCLOCK_H
+
+#include <stdint.h>
+
+// CMT1 wraps, and its interrupt wakes the CPU, this often.
+#define SYSCLOCK_WRAP_US    43690u
+
+void     sysclock_init(void);
+uint64_t sysclock_us(void);
+uint32_t sysclock_ms(void);
+
+#ifdef __ICCRX__
+__interrupt void sysclock_isr(void);
+#endif
+
+#endif /* _SYSCLOCK_H */
@@ -0,0 +1,121 @@
+/** \file tasklight.c
+*
+* @brief Show the running task's priority on the user LEDs.
+*
+* LEDs 7 through 15 light for the task of matching priority (15 is idle).
+* Those nine LEDs are spread over ports D and E, so for each priority the
+* port bits are worked out ahead of time and a context switch costs one
+* masked write per port, with interrupts already disabled by the kernel.
+*
+* @par
+* COPYRIGHT NOTICE: (C) 2014 Barr Group, LLC.
+* All rights reserved.
+*/
+
+#include <stdint.h>
+
+#include "cpu.h"
+#include "cpu_core.h"
+#include "os.h"
+#include "iorx63n.h"
+
+#include "tasklight.h"
+
+
+// The LEDs are active low. Port bits per the YRDKRX63N schematic:
+//   LED  7: PE0    LED  8: PD4    LED  9: PE2
+//   LED 10: PD1    LED 11: PD7    LED 12: PD3
+//   LED 13: PE1    LED 14: PD0    LED 15: PD6
+// LEDs 4 to 6 (PD5, PE3, PD2) belong to others and are never touched.
+#define TASKLIGHT_PD_MASK   0xDBu
+#define TASKLIGHT_PE_MASK   0x07u
+
+#define PD_ON(bit)          { (uint8_t)(TASKLIGHT_PD_MASK & ~(1u << (bit))), TASKLIGHT_PE_MASK }
+#define PE_ON(bit)          { TASKLIGHT_PD_MASK, (uint8_t)(TASKLIGHT_PE_MASK & ~(1u << (bit))) }
+#define ALL_OFF             { TASKLIGHT_PD_MASK, TASKLIGHT_PE_MASK }
+
+typedef struct
+{
+    uint8_t  pd;
+    uint8_t  pe;
+} tasklight_bits_t;
+
+// Port D and E output bits for each priority. The size is left to the
+// initializer so that a short table fails the check below; a missing entry
+// would otherwise be zero, which lights every one of these LEDs.
+static tasklight_bits_t const g_prio_bits[] =
+{
+    ALL_OFF,    ALL_OFF,    ALL_OFF,    ALL_OFF,        //  0 -  3
+    ALL_OFF,    ALL_OFF,    ALL_OFF,    PE_ON(0),       //  4 -  7
+    PD_ON(4),   PE_ON(2),   PD_ON(1),   PD_ON(7),       //  8 - 11
+    PD_ON(3),   PE_ON(1),   PD_ON(0),   PD_ON(6),       // 12 - 15
+};
+
+// Fails to compile, with a negative array size, unless the table has
+// exactly one entry per priority.
+typedef char prio_bits_complete[(sizeof(g_prio_bits) / sizeof(g_prio_bits[0]) == OS_CFG_PRIO_MAX) ? 1 : -1];
+
+static tasklight_stats_t  g_stats;
+
+
+/*!
+* @brief Light the LED for the task about to run.
+* @param[in] p_tcb The task being switched in.
+* @note  Called from App_OS_TaskSwHook(), with interrupts disabled.
+*/
+void
+tasklight_show (OS_TCB const * p_tcb)
+{
+    CPU_TS32                 start;
+    CPU_TS32                 cost;
+    tasklight_bits_t const * p_bits;
+
+
+    start = CPU_TS_Get32();
+
+    if ((p_tcb != 0) && (p_tcb->Prio < OS_CFG_PRIO_MAX))
+    {
+        p_bits = &g_prio_bits[p_tcb->Prio];
+
+        PORTD.PODR.BYTE = (PORTD.PODR.BYTE & ~TASKLIGHT_PD_MASK) | p_bits->pd;
+        PORTE.PODR.BYTE = (PORTE.PODR.BYTE & ~TASKLIGHT_PE_MASK) | p_bits->pe;
+    }
+
+    cost = CPU_TS_Get32() - start;
+
+    g_stats.switches++;
+    g_stats.cost_last_ts = cost;
+    if (cost > g_stats.cost_max_ts)
+    {
+        g_stats.cost_max_ts = cost;
+    }
+}
+
+/*!
+* @brief Copy out the per-switch cost figures.
+* @param[out] p_stats Where to put them.
+*/
+void
+tasklight_stats_get (tasklight_stats_t * p_stats)
+{
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    *p_stats = g_stats;
+    CPU_CRITICAL_EXIT();
+}
+
+/*!
+* @brief Worst-case cost of one update.
+* @return Microseconds.
+*/
+uint32_t
+tasklight_cost_max_us (void)
+{
+    tasklight_stats_t stats;
+
+    tasklight_stats_get(&stats);
+
+    return (uint32_t)CPU_TS32_to_uSec(stats.cost_max_ts);
+}
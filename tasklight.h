@@ -0,0 +1,32 @@
+/** \file tasklight.h
+*
+* @brief Show the running task's priority on the user LEDs.
+*
+* @par
+* COPYRIGHT NOTICE: (C) 2014 Barr Group, LLC.
+* All rights reserved.
+*/
+
+#ifndef _TASKLIGHT_H
+#define _TASKLIGHT_H
+
+#include <stdint.h>
+
+#include "os.h"
+
+// Set to 0 to take the LED update out of the context switch altogether.
+#define TASKLIGHT_EN    1
+
+// Cost of the update on each context switch, in CPU_TS counts.
+typedef struct
+{
+    uint32_t  switches;
+    uint32_t  cost_last_ts;
+    uint32_t  cost_max_ts;
+} tasklight_stats_t;
+
+void     tasklight_show(OS_TCB const * p_tcb);
+void     tasklight_stats_get(tasklight_stats_t * p_stats);
+uint32_t tasklight_cost_max_us(void);
+
+#endif /* _TASKLIGHT_H */
@@ -0,0 +1,148 @@
+/** \file tasks.c
+*
+* @brief The application's tasks, in one table.
+*
+* TASK_TABLE in tasks.h is expanded here into a stack of its own size for
+* each task, a TCB each, and a constant table that task_create() works
+* from. Nothing else calls OSTaskCreate().
+*
+* @par
+* COPYRIGHT NOTICE: (C) 2014 Barr Group, LLC.
+* All rights reserved.
+*/
+
+#include <assert.h>
+#include <stdint.h>
+
+#include "os.h"
+
+#include "alarm.h"
+#include "calculator.h"
+#include "display.h"
+#include "pushbutton.h"
+#include "tasks.h"
+
+
+typedef struct
+{
+    char const *  p_name;
+    OS_TASK_PTR   p_entry;
+    OS_PRIO       prio;
+    CPU_STK *     p_stk;
+    CPU_STK_SIZE  stk_size;
+    OS_MSG_QTY    q_size;
+    uint16_t      period_ms;
+    uint8_t       b_auto;
+} task_def_t;
+
+// The stacks, each its own size.
+#define TASK_STACK(id, name, entry, prio, stack, queue, period, b_auto) \
+    static CPU_STK g_stk_##id[stack];
+
+TASK_TABLE(TASK_STACK)
+
+static OS_TCB  g_tcbs[TASK_COUNT];
+
+#define TASK_DEF(id, name, entry, prio, stack, queue, period, b_auto) \
+    { name, entry, prio, &g_stk_##id[0], stack, queue, period, b_auto },
+
+static task_def_t const g_tasks[TASK_COUNT] =
+{
+    TASK_TABLE(TASK_DEF)
+};
+
+// Priority 0 and the lowest belong to the kernel; a table entry outside
+// the range fails to compile, with a negative array size.
+#define TASK_PRIO_RANGE(id, name, entry, prio, stack, queue, period, b_auto) \
+    typedef char prio_in_range_##id[((prio) > 0 && (prio) < OS_CFG_PRIO_MAX - 1) ? 1 : -1];
+
+TASK_TABLE(TASK_PRIO_RANGE)
+
+// Two entries with the same priority make two identical case labels,
+// which fails to compile. Never called.
+#define TASK_PRIO_CASE(id, name, entry, prio, stack, queue, period, b_auto) \
+    case (prio):
+
+static void
+tasks_prio_unique (OS_PRIO prio)
+{
+    switch (prio)
+    {
+    TASK_TABLE(TASK_PRIO_CASE)
+    default:
+        break;
+    }
+}
+
+// Stack words taken by all the tasks together.
+#define TASK_STACK_WORDS(id, name, entry, prio, stack, queue, period, b_auto) \
+    + (stack)
+
+#define TASKS_STK_WORDS     (0 TASK_TABLE(TASK_STACK_WORDS))
+
+
+/*!
+* @brief Create one task from the table.
+* @param[in] id    The task.
+* @param[in] p_arg Passed to its entry function.
+*/
+void
+task_create (task_id_t id, void * p_arg)
+{
+    task_def_t const * p_def = &g_tasks[id];
+    OS_ERR             err;
+
+
+    (void)tasks_prio_unique;
+
+    OSTaskCreate((OS_TCB     *)&g_tcbs[id],
+                 (CPU_CHAR   *) p_def->p_name,
+                 (OS_TASK_PTR ) p_def->p_entry,
+                 (void       *) p_arg,
+                 (OS_PRIO     ) p_def->prio,
+                 (CPU_STK    *) p_def->p_stk,
+                 (CPU_STK_SIZE) p_def->stk_size / 10u,
+                 (CPU_STK_SIZE) p_def->stk_size,
+                 (OS_MSG_QTY  ) p_def->q_size,
+                 (OS_TICK     ) 0u,
+                 (void       *) 0,
+                 (OS_OPT      ) 0,
+                 (OS_ERR     *)&err);
+    assert(OS_ERR_NONE == err);
+}
+
+/*!
+* @brief The TCB of a task in the table, e.g. to delete it.
+* @param[in] id The task.
+*/
+OS_TCB *
+task_tcb (task_id_t id)
+{
+    return &g_tcbs[id];
+}
+
+/*!
+* @brief Create every task marked to start automatically, in table order.
+*/
+void
+tasks_create_all (void)
+{
+    for (uint8_t i = 0; i < TASK_COUNT; i++)
+    {
+        if (g_tasks[i].b_auto)
+        {
+            task_create((task_id_t)i, 0);
+        }
+    }
+}
+
+/*!
+* @brief RAM taken by the stacks and TCBs of all the tasks in the table.
+* @return Bytes.
+* @note  Shown on the hidden stacks page.
+*/
+uint32_t
+tasks_ram_bytes (void)
+{
+    return (TASKS_STK_WORDS * sizeof(CPU_STK)) + sizeof(g_tcbs);
+}
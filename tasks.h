@@ -0,0 +1,50 @@
+/** \file tasks.h
+*
+* @brief The application's tasks, in one table.
+*
+* @par
+* COPYRIGHT NOTICE: (C) 2014 Barr Group, LLC.
+* All rights reserved.
+*/
+
+#ifndef _TASKS_H
+#define _TASKS_H
+
+#include <stdint.h>
+
+#include "os.h"
+
+// Every application task, highest priority first (0 = highest; 15 = idle).
+// Priorities must be unique; tasks.c will not compile otherwise.
+// Stack sizes are in CPU_STK words, each from the task's deepest call chain
+// plus a margin, and can be checked against the high-water marks on the
+// hidden stacks page. Period is in ms, 0 if event driven.
+// Auto-started tasks are created by tasks_create_all(), the others by
+// task_create() when they are wanted.
+//
+//  X(id,            name,                entry,           prio, stack, queue,        period, auto)
+#define TASK_TABLE(X)                                                                                \
+    X(TASK_STARTUP,  "Startup Task",      startup_task,       1,   128, 0,                  0, 0)    \
+    X(TASK_ALARM,    "Alarms",            alarm_task,         6,    96, ALARM_Q_SIZE,       0, 1)    \
+    X(TASK_DEBOUNCE, "Button Debouncer",  debounce_task,      7,    96, 0,                 50, 1)    \
+    X(TASK_CALC,     "Dive Calculations", calculator_task,   10,   128, 0,      CALC_FRAME_MS, 1)    \
+    X(TASK_SPEAKER,  "Speaker Task",      speaker_task,      11,    64, 0,                  0, 0)    \
+    X(TASK_DISPLAY,  "Display",           display_task,      12,   256, 0,                250, 1)
+
+#define TASK_ID(id, name, entry, prio, stack, queue, period, b_auto)    id,
+
+typedef enum
+{
+    TASK_TABLE(TASK_ID)
+    TASK_COUNT
+} task_id_t;
+
+// Defined in divecomputer.c.
+void startup_task(void * p_arg);
+
+void     task_create(task_id_t id, void * p_arg);
+OS_TCB * task_tcb(task_id_t id);
+void     tasks_create_all(void);
+uint32_t tasks_ram_bytes(void);
+
+#endif /* _TASKS_H */
@@ -0,0 +1,73 @@
+/** \file mock_lcd_dma.c
+*
+* @brief Host stand-in for lcd_dma.c that records the SPI byte stream.
+*
+* @par
+* COPYRIGHT NOTICE: (C) 2014 Barr Group, LLC.
+* All rights reserved.
+*/
+
+#include <assert.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "lcd_dma.h"
+#include "mock_lcd_dma.h"
+
+
+mock_spi_xfer_t  g_mock_spi[MOCK_SPI_MAX_XFERS];
+uint8_t          g_mock_spi_n;
+uint8_t          g_mock_spi_timeouts;
+
+
+static void
+mock_spi_record (uint8_t b_data, uint8_t const * p_bytes, uint8_t len)
+{
+    mock_spi_xfer_t * p_xfer;
+
+
+    assert(g_mock_spi_n < MOCK_SPI_MAX_XFERS);
+    assert(len <= MOCK_SPI_MAX_LEN);
+
+    p_xfer = &g_mock_spi[g_mock_spi_n++];
+    p_xfer->b_data = b_data;
+    p_xfer->len    = len;
+    memcpy(p_xfer->bytes, p_bytes, len);
+}
+
+/*!
+* @brief Forget everything recorded so far.
+*/
+void
+mock_spi_reset (void)
+{
+    memset(g_mock_spi, 0, sizeof(g_mock_spi));
+    g_mock_spi_n = 0;
+    g_mock_spi_timeouts = 0;
+}
+
+void
+lcd_dma_init (void)
+{
+    mock_spi_reset();
+}
+
+void
+lcd_dma_command (uint8_t const * p_cmd, uint8_t len)
+{
+    mock_spi_record(0, p_cmd, len);
+}
+
+lcd_dma_err_t
+lcd_dma_data (uint8_t const * p_data, uint8_t len)
+{
+    mock_spi_record(1, p_data, len);
+
+    if (g_mock_spi_timeouts > 0)
+    {
+        g_mock_spi_timeouts--;
+        return LCD_DMA_ERR_TIMEOUT;
+    }
+
+    return LCD_DMA_ERR_NONE;
+}
@@ -0,0 +1,34 @@
+/** \file mock_lcd_dma.h
+*
+* @brief Host stand-in for lcd_dma.c that records the SPI byte stream.
+*
+* @par
+* COPYRIGHT NOTICE: (C) 2014 Barr Group, LLC.
+* All rights reserved.
+*/
+
+#ifndef _MOCK_LCD_DMA_H
+#define _MOCK_LCD_DMA_H
+
+#include <stdint.h>
+
+#define MOCK_SPI_MAX_XFERS  32
+#define MOCK_SPI_MAX_LEN    128
+
+// One chip-select cycle: commands with RS low, display data with RS high.
+typedef struct
+{
+    uint8_t  b_data;
+    uint8_t  len;
+    uint8_t  bytes[MOCK_SPI_MAX_LEN];
+} mock_spi_xfer_t;
+
+extern mock_spi_xfer_t  g_mock_spi[MOCK_SPI_MAX_XFERS];
+extern uint8_t          g_mock_spi_n;
+
+// This many of the coming data transfers time out.
+extern uint8_t          g_mock_spi_timeouts;
+
+void mock_spi_reset(void);
+
+#endif /* _MOCK_LCD_DMA_H */
@@ -0,0 +1,50 @@
+/** \file mock_lib_mem.c
+*
+* @brief Host stand-in for the uC/LIB heap, the same size as the target's.
+*
+* @par
+* COPYRIGHT NOTICE: (C) 2014 Barr Group, LLC.
+* All rights reserved.
+*/
+
+#include <stdint.h>
+
+#include "lib_cfg.h"
+#include "lib_mem.h"
+
+
+static uint8_t     g_heap[LIB_MEM_CFG_HEAP_SIZE] __attribute__((aligned(8)));
+static CPU_SIZE_T  g_used;
+
+
+void *
+Mem_HeapAlloc (CPU_SIZE_T size, CPU_SIZE_T align, CPU_SIZE_T * p_bytes_reqd, LIB_ERR * p_err)
+{
+    CPU_SIZE_T start = (g_used + align - 1) & ~(align - 1);
+
+
+    *p_bytes_reqd = (start - g_used) + size;
+
+    if (start + size > sizeof(g_heap))
+    {
+        *p_err = LIB_MEM_ERR_HEAP_EMPTY;
+        return 0;
+    }
+
+    g_used = start + size;
+    *p_err = LIB_MEM_ERR_NONE;
+
+    return &g_heap[start];
+}
+
+void
+mock_heap_reset (void)
+{
+    g_used = 0;
+}
+
+CPU_SIZE_T
+mock_heap_used (void)
+{
+    return g_used;
+}
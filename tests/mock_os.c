@@ -0,0 +1,104 @@
+/** \file mock_os.c
+*
+* @brief Host stand-in for the uC/OS-III tick count and timers.
+*
+* @par
+* COPYRIGHT NOTICE: (C) 2014 Barr Group, LLC.
+* All rights reserved.
+*/
+
+#include <assert.h>
+#include <stdint.h>
+
+#include "os.h"
+
+
+// Kernel ticks to one timer task period.
+#define MOCK_TICKS_PER_TMR  (OS_CFG_TICK_RATE_HZ / OS_CFG_TMR_TASK_RATE_HZ)
+
+static OS_TMR *  g_last_tmr;
+static OS_TICK   g_now;
+
+
+void
+OSTmrCreate (OS_TMR * p_tmr, char * p_name, OS_TICK dly, OS_TICK period, OS_OPT opt,
+             OS_TMR_CALLBACK_PTR p_callback, void * p_callback_arg, OS_ERR * p_err)
+{
+    (void)p_name;
+
+    // As in the kernel, creating a running timer would corrupt the wheel.
+    assert(!p_tmr->b_running);
+
+    p_tmr->p_callback     = p_callback;
+    p_tmr->p_callback_arg = p_callback_arg;
+    p_tmr->dly            = dly;
+    p_tmr->period         = period;
+    p_tmr->opt            = opt;
+
+    *p_err = OS_ERR_NONE;
+}
+
+uint8_t
+OSTmrStart (OS_TMR * p_tmr, OS_ERR * p_err)
+{
+    OS_TICK dly = (p_tmr->dly > 0) ? p_tmr->dly : p_tmr->period;
+
+    g_last_tmr = p_tmr;
+    p_tmr->b_running = 1;
+    p_tmr->due = g_now + dly * MOCK_TICKS_PER_TMR;
+    *p_err = OS_ERR_NONE;
+
+    return 1;
+}
+
+uint8_t
+OSTmrStop (OS_TMR * p_tmr, OS_OPT opt, void * p_callback_arg, OS_ERR * p_err)
+{
+    (void)opt;
+    (void)p_callback_arg;
+
+    p_tmr->b_running = 0;
+    *p_err = OS_ERR_NONE;
+
+    return 1;
+}
+
+OS_TICK
+OSTimeGet (OS_ERR * p_err)
+{
+    *p_err = OS_ERR_NONE;
+
+    return g_now;
+}
+
+OS_TMR *
+mock_tmr_last (void)
+{
+    return g_last_tmr;
+}
+
+void
+mock_os_advance (OS_TICK ticks)
+{
+    OS_TMR * p_tmr;
+
+
+    while (ticks--)
+    {
+        g_now++;
+
+        p_tmr = g_last_tmr;
+        if ((0 != p_tmr) && p_tmr->b_running && (g_now == p_tmr->due))
+        {
+            if (OS_OPT_TMR_PERIODIC == p_tmr->opt)
+            {
+                p_tmr->due += p_tmr->period * MOCK_TICKS_PER_TMR;
+            }
+            else
+            {
+                p_tmr->b_running = 0;
+            }
+            p_tmr->p_callback(p_tmr, p_tmr->p_callback_arg);
+        }
+    }
+}
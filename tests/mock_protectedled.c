@@ -0,0 +1,28 @@
+/** \file mock_protectedled.c
+*
+* @brief Host stand-in for the LED ports behind protectedLED_Write().
+*
+* @par
+* COPYRIGHT NOTICE: (C) 2014 Barr Group, LLC.
+* All rights reserved.
+*/
+
+#include <stdint.h>
+
+#include "protectedled.h"
+#include "mock_protectedled.h"
+
+
+// Every LED off, as after BSP_Init().
+uint8_t   g_mock_port_d = 0xFF;
+uint8_t   g_mock_port_e = 0xFF;
+uint32_t  g_mock_led_writes;
+
+
+void
+protectedLED_Write (uint8_t pd_mask, uint8_t pd, uint8_t pe_mask, uint8_t pe)
+{
+    g_mock_port_d = (g_mock_port_d & ~pd_mask) | (pd & pd_mask);
+    g_mock_port_e = (g_mock_port_e & ~pe_mask) | (pe & pe_mask);
+    g_mock_led_writes++;
+}
@@ -0,0 +1,20 @@
+/** \file mock_protectedled.h
+*
+* @brief Host stand-in for the LED ports behind protectedLED_Write().
+*
+* @par
+* COPYRIGHT NOTICE: (C) 2014 Barr Group, LLC.
+* All rights reserved.
+*/
+
+#ifndef _MOCK_PROTECTEDLED_H
+#define _MOCK_PROTECTEDLED_H
+
+#include <stdint.h>
+
+// Port D and E output registers as last written; the LEDs are active low.
+extern uint8_t   g_mock_port_d;
+extern uint8_t   g_mock_port_e;
+extern uint32_t  g_mock_led_writes;
+
+#endif /* _MOCK_PROTECTEDLED_H */
@@ -0,0 +1,29 @@
+/** \file cpu.h
+*
+* @brief Host stand-in for the uC/CPU port: types and critical sections.
+*
+* The tests are single-threaded, so a critical section is a no-op.
+*
+* @par
+* COPYRIGHT NOTICE: (C) 2014 Barr Group, LLC.
+* All rights reserved.
+*/
+
+#ifndef _CPU_H
+#define _CPU_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef uint8_t   CPU_INT08U;
+typedef uint16_t  CPU_INT16U;
+typedef uint32_t  CPU_INT32U;
+typedef size_t    CPU_SIZE_T;
+typedef uint32_t  CPU_SR;
+typedef uint32_t  CPU_TS32;
+
+#define CPU_SR_ALLOC()          CPU_SR cpu_sr = 0; (void)cpu_sr
+#define CPU_CRITICAL_ENTER()
+#define CPU_CRITICAL_EXIT()
+
+#endif /* _CPU_H */
@@ -0,0 +1,27 @@
+/** \file lib_mem.h
+*
+* @brief Host stand-in for the uC/LIB heap.
+*
+* @par
+* COPYRIGHT NOTICE: (C) 2014 Barr Group, LLC.
+* All rights reserved.
+*/
+
+#ifndef _LIB_MEM_H
+#define _LIB_MEM_H
+
+#include "cpu.h"
+
+typedef enum
+{
+    LIB_MEM_ERR_NONE,
+    LIB_MEM_ERR_HEAP_EMPTY,
+} LIB_ERR;
+
+void * Mem_HeapAlloc(CPU_SIZE_T size, CPU_SIZE_T align, CPU_SIZE_T * p_bytes_reqd, LIB_ERR * p_err);
+
+// Test hooks: start over with an empty heap, and see how much is used.
+void       mock_heap_reset(void);
+CPU_SIZE_T mock_heap_used(void);
+
+#endif /* _LIB_MEM_H */
@@ -0,0 +1,64 @@
+/** \file os.h
+*
+* @brief Host stand-in for the parts of uC/OS-III the tested modules use.
+*
+* Time stands still until the test calls mock_os_advance(), which also
+* fires a started timer when its delay runs out.
+*
+* @par
+* COPYRIGHT NOTICE: (C) 2014 Barr Group, LLC.
+* All rights reserved.
+*/
+
+#ifndef _OS_H
+#define _OS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "cpu.h"
+#include "os_cfg_app.h"
+
+typedef uint8_t   OS_PRIO;
+typedef uint32_t  OS_TICK;
+typedef uint32_t  OS_OPT;
+
+typedef enum
+{
+    OS_ERR_NONE = 0,
+} OS_ERR;
+
+#define OS_OPT_TMR_NONE         0u
+#define OS_OPT_TMR_ONE_SHOT     1u
+#define OS_OPT_TMR_PERIODIC     2u
+
+typedef void (*OS_TMR_CALLBACK_PTR)(void * p_tmr, void * p_arg);
+
+typedef struct
+{
+    OS_TMR_CALLBACK_PTR  p_callback;
+    void *               p_callback_arg;
+    OS_TICK              dly;           // In timer task periods.
+    OS_TICK              period;
+    OS_OPT               opt;
+    uint8_t              b_running;
+    OS_TICK              due;           // Kernel tick it fires on.
+} OS_TMR;
+
+typedef struct
+{
+    OS_PRIO  Prio;
+} OS_TCB;
+
+void OSTmrCreate(OS_TMR * p_tmr, char * p_name, OS_TICK dly, OS_TICK period, OS_OPT opt,
+                 OS_TMR_CALLBACK_PTR p_callback, void * p_callback_arg, OS_ERR * p_err);
+uint8_t OSTmrStart(OS_TMR * p_tmr, OS_ERR * p_err);
+uint8_t OSTmrStop(OS_TMR * p_tmr, OS_OPT opt, void * p_callback_arg, OS_ERR * p_err);
+OS_TICK OSTimeGet(OS_ERR * p_err);
+
+// Test hooks: the timer started last, and moving the kernel tick on, one
+// tick at a time, running that timer's callback as the timer task would.
+OS_TMR * mock_tmr_last(void);
+void     mock_os_advance(OS_TICK ticks);
+
+#endif /* _OS_H */
@@ -0,0 +1,48 @@
+/** \file test.h
+*
+* @brief Minimal checks for the host-side unit tests.
+*
+* Each test program is a main() that calls its test functions through
+* TEST_RUN() and returns test_result(). A failed TEST_CHECK() reports the
+* file and line and lets the rest of the test carry on.
+*
+* @par
+* COPYRIGHT NOTICE: (C) 2014 Barr Group, LLC.
+* All rights reserved.
+*/
+
+#ifndef _TEST_H
+#define _TEST_H
+
+#include <stdio.h>
+
+static int  g_test_checks;
+static int  g_test_failures;
+
+#define TEST_CHECK(cond)                                                    \
+    do                                                                      \
+    {                                                                       \
+        g_test_checks++;                                                    \
+        if (!(cond))                                                        \
+        {                                                                   \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            g_test_failures++;                                              \
+        }                                                                   \
+    } while (0)
+
+#define TEST_RUN(test)                                                      \
+    do                                                                      \
+    {                                                                       \
+        printf("  %s\n", #test);                                            \
+        test();                                                             \
+    } while (0)
+
+static int
+test_result (char const * p_name)
+{
+    printf("%s: %d checks, %d failed\n", p_name, g_test_checks, g_test_failures);
+
+    return (0 == g_test_failures) ? 0 : 1;
+}
+
+#endif /* _TEST_H */
@@ -0,0 +1,168 @@
+/** \file test_calc_input.c
+*
+* @brief Host tests of the calculator's input dispatch, with simulated
+*        sample, button and timeout events.
+*
+* @par
+* COPYRIGHT NOTICE: (C) 2014 Barr Group, LLC.
+* All rights reserved.
+*/
+
+#include <stdint.h>
+#include <string.h>
+
+#include "calc_input.h"
+#include "test.h"
+
+
+static CalcInputs        g_inputs;
+static CalculationState  g_state;
+
+
+// A surfaced diver on the main page, metric, with nothing gathered yet.
+static void
+setup (void)
+{
+    memset(&g_inputs, 0, sizeof(g_inputs));
+    memset(&g_state, 0, sizeof(g_state));
+    g_state.display_page  = CALC_PAGE_MAIN;
+    g_state.display_units = CALC_UNITS_METRIC;
+}
+
+static uint8_t
+send (CalcEvent event)
+{
+    return calc_input_dispatch(event, NULL, &g_inputs, &g_state);
+}
+
+static void
+test_sample_is_kept (void)
+{
+    adc_sample_t const first  = { 100, 5000 };
+    adc_sample_t const second = { 200, 6000 };
+
+    setup();
+
+    TEST_CHECK(0 == calc_input_dispatch(CALC_EV_SAMPLE, &first, &g_inputs, &g_state));
+    TEST_CHECK(100 == g_inputs.adc);
+    TEST_CHECK(5000 == g_inputs.adc_time_us);
+    TEST_CHECK(g_inputs.b_adc_fresh);
+
+    // Only the latest sample before the frame counts.
+    TEST_CHECK(0 == calc_input_dispatch(CALC_EV_SAMPLE, &second, &g_inputs, &g_state));
+    TEST_CHECK(200 == g_inputs.adc);
+    TEST_CHECK(6000 == g_inputs.adc_time_us);
+}
+
+static void
+test_sw1_presses_counted (void)
+{
+    setup();
+
+    for (uint8_t i = 0; i < 3; i++)
+    {
+        TEST_CHECK(0 == send(CALC_EV_SW1));
+    }
+    TEST_CHECK(3 == g_inputs.sw1_presses);
+
+    // SW1 never moves the display.
+    TEST_CHECK(CALC_PAGE_MAIN == g_state.display_page);
+    TEST_CHECK(CALC_UNITS_METRIC == g_state.display_units);
+}
+
+static void
+test_sw2_steps_display_modes (void)
+{
+    setup();
+
+    TEST_CHECK(0 == send(CALC_EV_SW2));
+    TEST_CHECK(CALC_PAGE_MAIN == g_state.display_page);
+    TEST_CHECK(CALC_UNITS_IMPERIAL == g_state.display_units);
+
+    // The profile page is always drawn in metric.
+    send(CALC_EV_SW2);
+    TEST_CHECK(CALC_PAGE_PROFILE == g_state.display_page);
+    TEST_CHECK(CALC_UNITS_METRIC == g_state.display_units);
+
+    send(CALC_EV_SW2);
+    TEST_CHECK(CALC_PAGE_MAIN == g_state.display_page);
+    TEST_CHECK(CALC_UNITS_METRIC == g_state.display_units);
+
+    TEST_CHECK(!g_inputs.b_diag_reset);
+}
+
+static void
+test_sw2_long_steps_hidden_pages (void)
+{
+    setup();
+    g_state.display_page = CALC_PAGE_PROFILE;
+
+    TEST_CHECK(0 == send(CALC_EV_SW2_LONG));
+    TEST_CHECK(CALC_PAGE_DIAG == g_state.display_page);
+
+    send(CALC_EV_SW2_LONG);
+    TEST_CHECK(CALC_PAGE_TASKS == g_state.display_page);
+
+    send(CALC_EV_SW2_LONG);
+    TEST_CHECK(CALC_PAGE_STACKS == g_state.display_page);
+
+    send(CALC_EV_SW2_LONG);
+    TEST_CHECK(CALC_PAGE_MAIN == g_state.display_page);
+}
+
+static void
+test_sw2_on_hidden_pages (void)
+{
+    setup();
+
+    // On the diagnostics page a short press asks for a reset, and stays.
+    g_state.display_page = CALC_PAGE_DIAG;
+    send(CALC_EV_SW2);
+    TEST_CHECK(g_inputs.b_diag_reset);
+    TEST_CHECK(CALC_PAGE_DIAG == g_state.display_page);
+
+    // On the tasks and stacks pages it does nothing at all.
+    g_inputs.b_diag_reset = 0;
+    g_state.display_page = CALC_PAGE_TASKS;
+    send(CALC_EV_SW2);
+    TEST_CHECK(!g_inputs.b_diag_reset);
+    TEST_CHECK(CALC_PAGE_TASKS == g_state.display_page);
+    TEST_CHECK(CALC_UNITS_METRIC == g_state.display_units);
+
+    g_state.display_page = CALC_PAGE_STACKS;
+    send(CALC_EV_SW2);
+    TEST_CHECK(!g_inputs.b_diag_reset);
+    TEST_CHECK(CALC_PAGE_STACKS == g_state.display_page);
+    TEST_CHECK(CALC_UNITS_METRIC == g_state.display_units);
+}
+
+static void
+test_timeout_runs_frame (void)
+{
+    adc_sample_t const sample = { 321, 7000 };
+
+    setup();
+
+    // Events between frames are gathered; only the timeout ends the wait.
+    TEST_CHECK(0 == calc_input_dispatch(CALC_EV_SAMPLE, &sample, &g_inputs, &g_state));
+    TEST_CHECK(0 == send(CALC_EV_SW1));
+    TEST_CHECK(1 == send(CALC_EV_TIMEOUT));
+
+    // The timeout leaves what was gathered for the stages.
+    TEST_CHECK(321 == g_inputs.adc);
+    TEST_CHECK(g_inputs.b_adc_fresh);
+    TEST_CHECK(1 == g_inputs.sw1_presses);
+}
+
+int
+main (void)
+{
+    TEST_RUN(test_sample_is_kept);
+    TEST_RUN(test_sw1_presses_counted);
+    TEST_RUN(test_sw2_steps_display_modes);
+    TEST_RUN(test_sw2_long_steps_hidden_pages);
+    TEST_RUN(test_sw2_on_hidden_pages);
+    TEST_RUN(test_timeout_runs_frame);
+
+    return test_result("calc_input");
+}
@@ -0,0 +1,232 @@
+/** \file test_lcd_fb.c
+*
+* @brief Host tests of the framebuffer's dirty spans and SPI byte stream.
+*
+* @par
+* COPYRIGHT NOTICE: (C) 2014 Barr Group, LLC.
+* All rights reserved.
+*/
+
+#include <stdint.h>
+#include <string.h>
+
+#include "lcd_fb.h"
+#include "mock_lcd_dma.h"
+#include "test.h"
+
+
+// Start from a flushed, all-zero panel with nothing recorded.
+static void
+setup (void)
+{
+    lcd_fb_init();
+    lcd_fb_flush();
+    mock_spi_reset();
+}
+
+// Check that transfer pair n sets the address to (page, col) and sends p_data.
+static void
+check_span (uint8_t n, uint8_t page, uint8_t col, uint8_t const * p_data, uint8_t len)
+{
+    mock_spi_xfer_t const * p_cmd  = &g_mock_spi[2 * n];
+    mock_spi_xfer_t const * p_data_xfer = &g_mock_spi[2 * n + 1];
+
+
+    TEST_CHECK(2 * n + 1 < g_mock_spi_n);
+
+    TEST_CHECK(!p_cmd->b_data);
+    TEST_CHECK(2 == p_cmd->len);
+    TEST_CHECK((0x40 | page) == p_cmd->bytes[0]);
+    TEST_CHECK((0x80 | col) == p_cmd->bytes[1]);
+
+    TEST_CHECK(p_data_xfer->b_data);
+    TEST_CHECK(len == p_data_xfer->len);
+    TEST_CHECK(0 == memcmp(p_data, p_data_xfer->bytes, len));
+}
+
+static void
+test_init_sends_whole_panel (void)
+{
+    static uint8_t const zeros[LCD_WIDTH];
+
+    lcd_fb_init();
+    lcd_fb_flush();
+
+    TEST_CHECK(2 * LCD_PAGES == g_mock_spi_n);
+    for (uint8_t page = 0; page < LCD_PAGES; page++)
+    {
+        check_span(page, page, 0, zeros, LCD_WIDTH);
+    }
+}
+
+static void
+test_clean_flush_sends_nothing (void)
+{
+    setup();
+
+    lcd_fb_flush();
+    TEST_CHECK(0 == g_mock_spi_n);
+}
+
+static void
+test_single_byte (void)
+{
+    uint8_t const bits = 0x5A;
+
+    setup();
+
+    lcd_fb_write(3, 10, &bits, 1);
+    lcd_fb_flush();
+
+    TEST_CHECK(2 == g_mock_spi_n);
+    check_span(0, 3, 10, &bits, 1);
+
+    // Flushing clears the span.
+    mock_spi_reset();
+    lcd_fb_flush();
+    TEST_CHECK(0 == g_mock_spi_n);
+}
+
+static void
+test_unchanged_bytes_not_dirty (void)
+{
+    uint8_t const bits[4] = { 0x01, 0x02, 0x03, 0x04 };
+
+    setup();
+    lcd_fb_write(2, 40, bits, sizeof(bits));
+    lcd_fb_flush();
+    mock_spi_reset();
+
+    lcd_fb_write(2, 40, bits, sizeof(bits));
+    lcd_fb_flush();
+    TEST_CHECK(0 == g_mock_spi_n);
+}
+
+static void
+test_span_covers_only_changed_columns (void)
+{
+    uint8_t const old_bits[4] = { 0x11, 0x22, 0x33, 0x44 };
+    uint8_t const new_bits[4] = { 0x11, 0x99, 0x88, 0x44 };
+
+    setup();
+    lcd_fb_write(1, 20, old_bits, sizeof(old_bits));
+    lcd_fb_flush();
+    mock_spi_reset();
+
+    lcd_fb_write(1, 20, new_bits, sizeof(new_bits));
+    lcd_fb_flush();
+
+    TEST_CHECK(2 == g_mock_spi_n);
+    check_span(0, 1, 21, &new_bits[1], 2);
+}
+
+static void
+test_writes_merge_per_page (void)
+{
+    uint8_t const a = 0xAA;
+    uint8_t const b = 0xBB;
+    uint8_t       expect[16] = { 0 };
+
+    setup();
+
+    lcd_fb_write(5, 20, &b, 1);
+    lcd_fb_write(5, 5, &a, 1);
+    lcd_fb_write(7, 0, &a, 1);
+    lcd_fb_flush();
+
+    // One span per dirty page, pages in order, the gap sent as it stands.
+    expect[0]  = a;
+    expect[15] = b;
+    TEST_CHECK(4 == g_mock_spi_n);
+    check_span(0, 5, 5, expect, sizeof(expect));
+    check_span(1, 7, 0, &a, 1);
+}
+
+static void
+test_write_clipped_at_edges (void)
+{
+    uint8_t const bits[5] = { 1, 2, 3, 4, 5 };
+
+    setup();
+
+    lcd_fb_write(0, LCD_WIDTH - 2, bits, sizeof(bits));
+    lcd_fb_write(LCD_PAGES, 0, bits, sizeof(bits));
+    lcd_fb_write(1, LCD_WIDTH, bits, sizeof(bits));
+    lcd_fb_flush();
+
+    TEST_CHECK(2 == g_mock_spi_n);
+    check_span(0, 0, LCD_WIDTH - 2, bits, 2);
+}
+
+static void
+test_string_sends_glyphs (void)
+{
+    uint8_t const glyph_a[5] = { 0x7E, 0x11, 0x11, 0x11, 0x7E };
+    uint8_t const glyph_1[5] = { 0x00, 0x42, 0x7F, 0x40, 0x00 };
+    uint8_t const blank[3] = { 0 };
+    uint8_t       expect[11] = { 0 };
+
+    setup();
+
+    // Lower case folds to upper; the spacing column stays blank.
+    lcd_fb_string(6, "a1");
+    lcd_fb_flush();
+
+    memcpy(&expect[0], glyph_a, 5);
+    memcpy(&expect[LCD_FONT_WIDTH], glyph_1, 5);
+
+    // The '1' glyph's last column is blank, so the span ends at column 9.
+    TEST_CHECK(2 == g_mock_spi_n);
+    check_span(0, 6, 0, expect, 10);
+
+    // Overwriting with a shorter string blanks the rest of the line.
+    mock_spi_reset();
+    lcd_fb_string(6, "A");
+    lcd_fb_flush();
+
+    TEST_CHECK(2 == g_mock_spi_n);
+    check_span(0, 6, LCD_FONT_WIDTH + 1, blank, sizeof(blank));
+}
+
+static void
+test_timeout_keeps_pages_dirty (void)
+{
+    uint8_t const bits[2] = { 0x11, 0x22 };
+
+    setup();
+
+    lcd_fb_write(2, 5, &bits[0], 1);
+    lcd_fb_write(4, 7, &bits[1], 1);
+
+    // The flush stops at the failed page and reports it.
+    g_mock_spi_timeouts = 1;
+    TEST_CHECK(LCD_DMA_ERR_TIMEOUT == lcd_fb_flush());
+    TEST_CHECK(2 == g_mock_spi_n);
+
+    // The retry sends both pages again, unchanged.
+    mock_spi_reset();
+    TEST_CHECK(LCD_DMA_ERR_NONE == lcd_fb_flush());
+    TEST_CHECK(4 == g_mock_spi_n);
+    check_span(0, 2, 5, &bits[0], 1);
+    check_span(1, 4, 7, &bits[1], 1);
+
+    mock_spi_reset();
+    TEST_CHECK(LCD_DMA_ERR_NONE == lcd_fb_flush());
+    TEST_CHECK(0 == g_mock_spi_n);
+}
+
+int
+main (void)
+{
+    TEST_RUN(test_init_sends_whole_panel);
+    TEST_RUN(test_clean_flush_sends_nothing);
+    TEST_RUN(test_single_byte);
+    TEST_RUN(test_unchanged_bytes_not_dirty);
+    TEST_RUN(test_span_covers_only_changed_columns);
+    TEST_RUN(test_writes_merge_per_page);
+    TEST_RUN(test_write_clipped_at_edges);
+    TEST_RUN(test_string_sends_glyphs);
+    TEST_RUN(test_timeout_keeps_pages_dirty);
+
+    return test_result("lcd_fb");
+}
@@ -0,0 +1,296 @@
+/** \file test_ledpattern.c
+*
+* @brief Host tests of LED pattern timing and the pattern engine.
+*
+* ledpattern_render() and ledpattern_next_ms() are tested on their own.
+* The engine in ledpattern.c is run against the mock kernel clock and
+* timer, and the LEDs are read back from the mock ports.
+*
+* @par
+* COPYRIGHT NOTICE: (C) 2014 Barr Group, LLC.
+* All rights reserved.
+*/
+
+#include <stdint.h>
+
+#include "os.h"
+#include "ledpattern.h"
+#include "mock_protectedled.h"
+#include "test.h"
+
+
+static ledpat_t const g_on      = { LEDPAT_ON,        0,   0 };
+static ledpat_t const g_breathe = { LEDPAT_BREATHE, 2000,   0 };
+
+
+// Whether an LED is lit on the mock ports (active low).
+static uint8_t
+led_lit (uint8_t led)
+{
+    switch (led)
+    {
+    case 4:  return !(g_mock_port_d & (1u << 5));
+    case 5:  return !(g_mock_port_e & (1u << 3));
+    case 6:  return !(g_mock_port_d & (1u << 2));
+    case 7:  return !(g_mock_port_e & (1u << 0));
+    default: return 0;
+    }
+}
+
+// One timer task period, the engine's finest step.
+#define TMR_MS      (1000u / OS_CFG_TMR_TASK_RATE_HZ)
+
+// Let the kernel run for a while, firing the engine's timer when it is due.
+static void
+run_ms (uint32_t ms)
+{
+    mock_os_advance((OS_TICK)((ms * OS_CFG_TICK_RATE_HZ) / 1000u));
+}
+
+static void
+test_render_on_off (void)
+{
+    uint16_t dither = 0;
+
+    TEST_CHECK(1 == ledpattern_render(&g_on, 0, &dither));
+    TEST_CHECK(1 == ledpattern_render(&g_on, 123456, &dither));
+    TEST_CHECK(0 == ledpattern_render(&g_ledpat_off, 0, &dither));
+    TEST_CHECK(0 == ledpattern_render(&g_ledpat_off, 123456, &dither));
+}
+
+static void
+test_render_blink (void)
+{
+    uint16_t dither = 0;
+
+    // Health: lit for the first 167 ms of every 334 ms.
+    TEST_CHECK(1 == ledpattern_render(&g_ledpat_health, 0, &dither));
+    TEST_CHECK(1 == ledpattern_render(&g_ledpat_health, 166, &dither));
+    TEST_CHECK(0 == ledpattern_render(&g_ledpat_health, 167, &dither));
+    TEST_CHECK(0 == ledpattern_render(&g_ledpat_health, 333, &dither));
+    TEST_CHECK(1 == ledpattern_render(&g_ledpat_health, 334, &dither));
+    TEST_CHECK(1 == ledpattern_render(&g_ledpat_health, 334 + 166, &dither));
+    TEST_CHECK(0 == ledpattern_render(&g_ledpat_health, 334 + 167, &dither));
+
+    // Strobe: 40 ms flashes every 120 ms.
+    TEST_CHECK(1 == ledpattern_render(&g_ledpat_strobe, 39, &dither));
+    TEST_CHECK(0 == ledpattern_render(&g_ledpat_strobe, 40, &dither));
+    TEST_CHECK(1 == ledpattern_render(&g_ledpat_strobe, 120, &dither));
+
+    // Blink leaves the dither alone.
+    TEST_CHECK(0 == dither);
+}
+
+static void
+test_render_blink_duty_per_tick (void)
+{
+    uint16_t dither = 0;
+    uint16_t lit = 0;
+
+    // Warn: 200 ms of every 1000 ms, so 10 of the 50 ticks in a period.
+    for (uint32_t t = 0; t < 1000; t += LEDPAT_TICK_MS)
+    {
+        lit += ledpattern_render(&g_ledpat_warn, t, &dither);
+    }
+    TEST_CHECK(10 == lit);
+}
+
+static void
+test_render_breathe (void)
+{
+    uint16_t dither = 0;
+    uint16_t lit_quarter[4] = { 0 };
+    uint16_t lit = 0;
+    uint8_t  b_lit;
+
+    // Two periods, one tick at a time as the engine calls it.
+    for (uint32_t t = 0; t < 2 * 2000; t += LEDPAT_TICK_MS)
+    {
+        b_lit = ledpattern_render(&g_breathe, t, &dither);
+
+        if (t < 2000)
+        {
+            lit_quarter[t / 500] += b_lit;
+        }
+        lit += b_lit;
+
+        // The dither never holds a whole tick's worth.
+        TEST_CHECK(dither < 256);
+    }
+
+    // Dark at the bottom of the fade, fully lit at the top.
+    dither = 0;
+    TEST_CHECK(0 == ledpattern_render(&g_breathe, 0, &dither));
+    TEST_CHECK(0 == dither);
+    TEST_CHECK(1 == ledpattern_render(&g_breathe, 1000, &dither));
+
+    // The squared triangle averages a third: 33 of every 100 ticks.
+    TEST_CHECK((lit >= 2 * 31) && (lit <= 2 * 35));
+
+    // Brighter towards the middle of the period, and the same each way.
+    TEST_CHECK(lit_quarter[0] < lit_quarter[1]);
+    TEST_CHECK(lit_quarter[3] < lit_quarter[2]);
+    TEST_CHECK((lit_quarter[0] + 1 >= lit_quarter[3]) && (lit_quarter[3] + 1 >= lit_quarter[0]));
+    TEST_CHECK((lit_quarter[1] + 1 >= lit_quarter[2]) && (lit_quarter[2] + 1 >= lit_quarter[1]));
+}
+
+static void
+test_next_change (void)
+{
+    // Health: from the top of the cycle to the end of the flash, then on
+    // to the next one.
+    TEST_CHECK(167 == ledpattern_next_ms(&g_ledpat_health, 0));
+    TEST_CHECK(1 == ledpattern_next_ms(&g_ledpat_health, 166));
+    TEST_CHECK(167 == ledpattern_next_ms(&g_ledpat_health, 167));
+    TEST_CHECK(1 == ledpattern_next_ms(&g_ledpat_health, 333));
+    TEST_CHECK(167 == ledpattern_next_ms(&g_ledpat_health, 334));
+
+    // Breathing needs every tick; steady LEDs need none.
+    TEST_CHECK(LEDPAT_TICK_MS == ledpattern_next_ms(&g_breathe, 1234));
+    TEST_CHECK(LEDPAT_NEVER == ledpattern_next_ms(&g_on, 0));
+    TEST_CHECK(LEDPAT_NEVER == ledpattern_next_ms(&g_ledpat_off, 0));
+}
+
+static void
+test_engine_owns_only_its_leds (void)
+{
+    // Leave every bit low, then see which ones the first tick sets.
+    g_mock_port_d = 0x00;
+    g_mock_port_e = 0x00;
+
+    ledpattern_init();
+    TEST_CHECK(0 == g_mock_led_writes);
+    TEST_CHECK(mock_tmr_last()->b_running);
+    TEST_CHECK(OS_OPT_TMR_ONE_SHOT == mock_tmr_last()->opt);
+
+    run_ms(TMR_MS);
+    TEST_CHECK(1 == g_mock_led_writes);
+
+    // LEDs 4 to 6 off (PD5, PE3, PD2); the task light's LEDs untouched.
+    TEST_CHECK(0x24 == g_mock_port_d);
+    TEST_CHECK(0x08 == g_mock_port_e);
+
+    // With every LED steady, nothing is left on the timer wheel.
+    TEST_CHECK(!mock_tmr_last()->b_running);
+
+    // LED 7 is the task light's; setting it changes nothing.
+    ledpattern_set(7, &g_on);
+    TEST_CHECK(!mock_tmr_last()->b_running);
+    run_ms(100);
+    TEST_CHECK(1 == g_mock_led_writes);
+    TEST_CHECK(0x24 == g_mock_port_d);
+    TEST_CHECK(0x08 == g_mock_port_e);
+}
+
+static void
+test_engine_blink_timing (void)
+{
+    uint8_t  lit[700 + 1];
+    uint32_t writes;
+    OS_TICK  due;
+
+
+    ledpattern_set(4, &g_ledpat_health);
+    writes = g_mock_led_writes;
+
+    // Takes effect at the next timer period, at the top of the cycle.
+    TEST_CHECK(!led_lit(4));
+    lit[0] = 0;
+    for (uint16_t t = 1; t <= 700; t++)
+    {
+        run_ms(1);
+        lit[t] = led_lit(4);
+    }
+
+    // Each edge shows no more than one timer period late.
+    TEST_CHECK(lit[TMR_MS] && lit[166]);
+    TEST_CHECK(!lit[167 + TMR_MS] && !lit[333]);
+    TEST_CHECK(lit[334 + TMR_MS] && lit[500]);
+    TEST_CHECK(!lit[501 + TMR_MS] && !lit[667]);
+    TEST_CHECK(lit[668 + TMR_MS]);
+
+    // One tick per edge, not one every LEDPAT_TICK_MS.
+    TEST_CHECK(writes + 5 == g_mock_led_writes);
+
+    // Setting the same pattern again neither restarts it nor re-arms.
+    due = mock_tmr_last()->due;
+    ledpattern_set(4, &g_ledpat_health);
+    TEST_CHECK(due == mock_tmr_last()->due);
+    run_ms(140);                                // 840 ms: phase 172, dark
+    TEST_CHECK(!led_lit(4));
+
+    ledpattern_set(4, &g_ledpat_off);
+    run_ms(TMR_MS);
+    TEST_CHECK(!led_lit(4));
+    TEST_CHECK(!mock_tmr_last()->b_running);
+}
+
+static void
+test_engine_breathe_rate (void)
+{
+    uint32_t writes;
+
+
+    ledpattern_set(5, &g_breathe);
+    run_ms(TMR_MS);
+
+    // Breathing is dithered every LEDPAT_TICK_MS.
+    writes = g_mock_led_writes;
+    run_ms(1000);
+    TEST_CHECK(writes + 1000 / LEDPAT_TICK_MS == g_mock_led_writes);
+
+    ledpattern_set(5, &g_ledpat_off);
+    run_ms(TMR_MS);
+    TEST_CHECK(!led_lit(5));
+    TEST_CHECK(!mock_tmr_last()->b_running);
+}
+
+static void
+test_engine_bar (void)
+{
+    uint32_t writes;
+
+    ledpattern_bar(4, 3, 2);
+
+    // Nothing changes until the next tick, and then all at once.
+    writes = g_mock_led_writes;
+    TEST_CHECK(!led_lit(4) && !led_lit(5) && !led_lit(6));
+    run_ms(TMR_MS);
+    TEST_CHECK(writes + 1 == g_mock_led_writes);
+    TEST_CHECK(led_lit(4) && led_lit(5) && !led_lit(6));
+
+    ledpattern_bar(4, 3, 3);
+    run_ms(TMR_MS);
+    TEST_CHECK(led_lit(4) && led_lit(5) && led_lit(6));
+
+    // A bar holds steady without the engine running at all.
+    writes = g_mock_led_writes;
+    run_ms(1000);
+    TEST_CHECK(writes == g_mock_led_writes);
+    TEST_CHECK(led_lit(4) && led_lit(5) && led_lit(6));
+
+    ledpattern_bar(4, 3, 1);
+    run_ms(TMR_MS);
+    TEST_CHECK(led_lit(4) && !led_lit(5) && !led_lit(6));
+
+    ledpattern_bar(4, 3, 0);
+    run_ms(TMR_MS);
+    TEST_CHECK(!led_lit(4) && !led_lit(5) && !led_lit(6));
+}
+
+int
+main (void)
+{
+    TEST_RUN(test_render_on_off);
+    TEST_RUN(test_render_blink);
+    TEST_RUN(test_render_blink_duty_per_tick);
+    TEST_RUN(test_render_breathe);
+    TEST_RUN(test_next_change);
+
+    TEST_RUN(test_engine_owns_only_its_leds);
+    TEST_RUN(test_engine_blink_timing);
+    TEST_RUN(test_engine_breathe_rate);
+    TEST_RUN(test_engine_bar);
+
+    return test_result("ledpattern");
+}
@@ -0,0 +1,183 @@
+/** \file test_mempool.c
+*
+* @brief Host tests of the fixed-block pools.
+*
+* @par
+* COPYRIGHT NOTICE: (C) 2014 Barr Group, LLC.
+* All rights reserved.
+*/
+
+#include <stdint.h>
+
+#include "lib_mem.h"
+#include "mempool.h"
+#include "test.h"
+
+
+// Pools stay on mempool.c's list for good, so every test has its own.
+static mempool_t  g_carve_pool;
+static mempool_t  g_small_pool;
+static mempool_t  g_dry_pool;
+static mempool_t  g_put_pool;
+static mempool_t  g_min_pool;
+static mempool_t  g_report_a;
+static mempool_t  g_report_b;
+
+
+static void
+test_create_carves_blocks (void)
+{
+    uint8_t * p_blk[5];
+
+    mock_heap_reset();
+    mempool_create(&g_carve_pool, "Carve", 13, 5);
+
+    // Rounded up to the alignment, all blocks free, taken from the heap once.
+    TEST_CHECK(16 == g_carve_pool.blk_size);
+    TEST_CHECK(5 == g_carve_pool.n_blks);
+    TEST_CHECK(5 == g_carve_pool.n_free);
+    TEST_CHECK(5 == g_carve_pool.n_free_min);
+    TEST_CHECK(0 == g_carve_pool.exhausted);
+    TEST_CHECK((16 * 5) == mock_heap_used());
+
+    // Blocks come out lowest address first, back to back and aligned.
+    for (uint8_t i = 0; i < 5; i++)
+    {
+        p_blk[i] = (uint8_t *)mempool_get(&g_carve_pool);
+        TEST_CHECK(p_blk[i] != 0);
+        TEST_CHECK(0 == ((uintptr_t)p_blk[i] % 8));
+    }
+    for (uint8_t i = 1; i < 5; i++)
+    {
+        TEST_CHECK(p_blk[i] == p_blk[i - 1] + 16);
+    }
+}
+
+static void
+test_small_blocks_hold_link (void)
+{
+    mock_heap_reset();
+    mempool_create(&g_small_pool, "Small", 1, 3);
+
+    TEST_CHECK(g_small_pool.blk_size >= sizeof(void *));
+    TEST_CHECK(0 == (g_small_pool.blk_size % 8));
+}
+
+static void
+test_get_runs_dry (void)
+{
+    mock_heap_reset();
+    mempool_create(&g_dry_pool, "Dry", 8, 2);
+
+    TEST_CHECK(mempool_get(&g_dry_pool) != 0);
+    TEST_CHECK(mempool_get(&g_dry_pool) != 0);
+    TEST_CHECK(0 == g_dry_pool.n_free);
+
+    // An empty pool returns NULL and counts every refusal.
+    TEST_CHECK(0 == mempool_get(&g_dry_pool));
+    TEST_CHECK(0 == mempool_get(&g_dry_pool));
+    TEST_CHECK(2 == g_dry_pool.exhausted);
+    TEST_CHECK(0 == g_dry_pool.n_free);
+}
+
+static void
+test_put_returns_block (void)
+{
+    void * p_a;
+    void * p_b;
+
+    mock_heap_reset();
+    mempool_create(&g_put_pool, "Put", 8, 2);
+
+    p_a = mempool_get(&g_put_pool);
+    p_b = mempool_get(&g_put_pool);
+    TEST_CHECK(0 == mempool_get(&g_put_pool));
+
+    mempool_put(&g_put_pool, p_a);
+    TEST_CHECK(1 == g_put_pool.n_free);
+
+    // The block put back is the next one out.
+    TEST_CHECK(p_a == mempool_get(&g_put_pool));
+
+    mempool_put(&g_put_pool, p_b);
+    mempool_put(&g_put_pool, p_a);
+    TEST_CHECK(2 == g_put_pool.n_free);
+    TEST_CHECK(p_a == mempool_get(&g_put_pool));
+    TEST_CHECK(p_b == mempool_get(&g_put_pool));
+}
+
+static void
+test_free_min_is_low_water (void)
+{
+    void * p_blk[3];
+
+    mock_heap_reset();
+    mempool_create(&g_min_pool, "Min", 8, 4);
+
+    p_blk[0] = mempool_get(&g_min_pool);
+    p_blk[1] = mempool_get(&g_min_pool);
+    p_blk[2] = mempool_get(&g_min_pool);
+    TEST_CHECK(1 == g_min_pool.n_free_min);
+
+    // Putting blocks back does not raise the mark.
+    mempool_put(&g_min_pool, p_blk[2]);
+    mempool_put(&g_min_pool, p_blk[1]);
+    TEST_CHECK(3 == g_min_pool.n_free);
+    TEST_CHECK(1 == g_min_pool.n_free_min);
+
+    // Only going lower than before moves it.
+    p_blk[1] = mempool_get(&g_min_pool);
+    TEST_CHECK(1 == g_min_pool.n_free_min);
+    (void)mempool_get(&g_min_pool);
+    (void)mempool_get(&g_min_pool);
+    TEST_CHECK(0 == g_min_pool.n_free_min);
+
+    // Running dry leaves it at zero.
+    TEST_CHECK(0 == mempool_get(&g_min_pool));
+    TEST_CHECK(0 == g_min_pool.n_free_min);
+}
+
+static void
+test_report (void)
+{
+    mempool_stats_t stats[2];
+    void *          p_blk;
+
+    mock_heap_reset();
+    mempool_create(&g_report_a, "A", 8, 3);
+    mempool_create(&g_report_b, "B", 24, 2);
+
+    p_blk = mempool_get(&g_report_a);
+    (void)mempool_get(&g_report_a);
+    mempool_put(&g_report_a, p_blk);
+    (void)mempool_get(&g_report_b);
+    (void)mempool_get(&g_report_b);
+    (void)mempool_get(&g_report_b);
+
+    // Most recently created first.
+    TEST_CHECK(2 == mempool_report(stats, 2));
+
+    TEST_CHECK('B' == stats[0].p_name[0]);
+    TEST_CHECK(24 == stats[0].blk_size);
+    TEST_CHECK(2 == stats[0].used);
+    TEST_CHECK(2 == stats[0].used_max);
+    TEST_CHECK(1 == stats[0].exhausted);
+
+    TEST_CHECK('A' == stats[1].p_name[0]);
+    TEST_CHECK(1 == stats[1].used);
+    TEST_CHECK(2 == stats[1].used_max);
+    TEST_CHECK(0 == stats[1].exhausted);
+}
+
+int
+main (void)
+{
+    TEST_RUN(test_create_carves_blocks);
+    TEST_RUN(test_small_blocks_hold_link);
+    TEST_RUN(test_get_runs_dry);
+    TEST_RUN(test_put_returns_block);
+    TEST_RUN(test_free_min_is_low_water);
+    TEST_RUN(test_report);
+
+    return test_result("mempool");
+}
@@ -0,0 +1,326 @@
+/** \file tickless.c
+*
+* @brief Tick suppression while the CPU is idle.
+*
+* uC/OS-III V3.04 has no dynamic tick of its own, so this is done from the
+* idle task hook. When nothing is ready to run, the next kernel deadline is
+* found from the tick wheel (task delays and pend timeouts) and the timer
+* wheel. CMT0, which drives the tick, is slowed down and its compare match
+* pushed out to that deadline, and the CPU waits. On wake-up the ticks that
+* passed without an interrupt are fed to OSTimeTick() before the scheduler
+* is allowed to run again, so the tick count and every delay stay exact.
+*
+* No sleep outlasts SYSCLOCK_WRAP_US, about 44 ms: the CMT1 wrap interrupt
+* that keeps sysclock_us() going ends it anyway. A slower CMT1 would allow
+* longer sleeps, but would coarsen every timestamp in the application.
+*
+* The scheduler is locked for the whole sleep. An interrupt that readies a
+* task therefore cannot switch away from the idle task while CMT0 is still
+* stretched; the switch happens once the tick has been put right.
+*
+* @par
+* COPYRIGHT NOTICE: (C) 2014 Barr Group, LLC.
+* All rights reserved.
+*/
+
+#include <assert.h>
+#include <stdint.h>
+
+#include <intrinsics.h>
+
+#include "cpu.h"
+#include "os.h"
+#include "iorx63n.h"
+
+#include "sysclock.h"
+#include "idle.h"
+#include "tickless.h"
+
+
+// CMT0 is the uC/OS-III tick source set up by the BSP; CMI0 is vector 28.
+#define VECT_CMT0_CMI0      28
+
+#define CMCR_CKS_MASK       0x0003u
+
+// While sleeping CMT0 runs from PCLK / 128, so a 16-bit compare could cover
+// about 174 ms instead of the 10 ms it covers at the BSP's PCLK / 8. The
+// sysclock wrap caps it lower still.
+#define TICKLESS_SLOW_CKS   2u
+
+#define TICKLESS_FOREVER    0xFFFFFFFFuL
+
+static uint8_t volatile * const p_IR_cmi0 = (uint8_t *)(0x00087000 + VECT_CMT0_CMI0);
+
+// CMT0 clock dividers, indexed by CMCR.CKS.
+static uint16_t const g_cks_div[] = { 8, 32, 128, 512 };
+
+// CMT0 as the BSP programmed it.
+static uint16_t  g_cmcr;
+static uint16_t  g_per_tick;        // Counts per tick at the BSP divider.
+
+static uint16_t  g_ratio;           // Slow divider over BSP divider.
+static uint16_t  g_per_tick_slow;   // Counts per tick at the slow divider.
+static OS_TICK   g_max_ticks;       // Longest sleep worth planning.
+
+static uint8_t            gb_ready;
+static uint8_t volatile   gb_stretched;     // CMT0 is set up for a sleep.
+static uint8_t            gb_announcing;    // OSTimeTick() is being replayed.
+
+static tickless_stats_t   g_stats;
+
+
+/*!
+* @brief Note how the BSP set up the tick so that it can be restored.
+* @note  Call after BSP_Init() has started the tick.
+*/
+void
+tickless_init (void)
+{
+    uint16_t cks;
+
+    g_cmcr     = CMT0.CMCR.WORD;
+    g_per_tick = CMT0.CMCOR + 1;
+
+    cks = g_cmcr & CMCR_CKS_MASK;
+    assert(cks <= TICKLESS_SLOW_CKS);
+
+    g_ratio         = g_cks_div[TICKLESS_SLOW_CKS] / g_cks_div[cks];
+    g_per_tick_slow = g_per_tick / g_ratio;
+    assert((g_per_tick_slow * g_ratio) == g_per_tick);
+
+    g_max_ticks = 0xFFFFu / g_per_tick_slow;
+
+    // No sleep outlasts a sysclock wrap period, so none is planned longer.
+    if (g_max_ticks > (SYSCLOCK_WRAP_US * OS_CFG_TICK_RATE_HZ) / 1000000uL)
+    {
+        g_max_ticks = (SYSCLOCK_WRAP_US * OS_CFG_TICK_RATE_HZ) / 1000000uL;
+    }
+
+    gb_ready = 1;
+}
+
+/*!
+* @brief Ticks until the next task delay, pend timeout or software timer.
+* @note  Call with interrupts disabled.
+*/
+static OS_TICK
+tickless_next_deadline (void)
+{
+    OS_TICK  next = TICKLESS_FOREVER;
+    OS_TICK  remain;
+
+    // Tasks waiting on a delay or a timeout become ready when the tick
+    // task's OSTickCtr reaches their TickCtrMatch.
+    for (OS_TICK_SPOKE_IX i = 0; i < OSCfg_TickWheelSize; i++)
+    {
+        for (OS_TCB * p_tcb = OSCfg_TickWheel[i].FirstPtr; p_tcb; p_tcb = p_tcb->TickNextPtr)
+        {
+            remain = p_tcb->TickCtrMatch - OSTickCtr;
+            if (remain < next)
+            {
+                next = remain;
+            }
+        }
+    }
+
+#if OS_CFG_TMR_EN > 0u
+    // The timer task steps OSTmrTickCtr once every OSTmrUpdateCnt ticks,
+    // the next step being OSTmrUpdateCtr ticks away.
+    for (OS_TMR_SPOKE_IX i = 0; i < OSCfg_TmrWheelSize; i++)
+    {
+        for (OS_TMR * p_tmr = OSCfg_TmrWheel[i].FirstPtr; p_tmr; p_tmr = p_tmr->NextPtr)
+        {
+            remain = OSTmrUpdateCtr + (p_tmr->Match - OSTmrTickCtr - 1) * OSTmrUpdateCnt;
+            if (remain < next)
+            {
+                next = remain;
+            }
+        }
+    }
+#endif
+
+    return next;
+}
+
+/*!
+* @brief Slow CMT0 down and move its compare match n_ticks ahead.
+* @note  Call with interrupts disabled.
+*/
+static void
+tickless_stretch (OS_TICK n_ticks)
+{
+    uint16_t count;
+
+    CMT.CMSTR0.BIT.STR0 = 0;
+
+    // Carry over the part of the current tick that has already gone by.
+    count = CMT0.CMCNT;
+    CMT0.CMCR.WORD = (g_cmcr & ~CMCR_CKS_MASK) | TICKLESS_SLOW_CKS;
+    CMT0.CMCNT = count / g_ratio;
+    CMT0.CMCOR = (uint16_t)(n_ticks * g_per_tick_slow - 1);
+
+    gb_stretched = 1;
+
+    CMT.CMSTR0.BIT.STR0 = 1;
+}
+
+/*!
+* @brief Put CMT0 back to one compare match per tick.
+* @return Whole ticks counted since the last tick interrupt.
+* @note  Call with interrupts disabled, or from the tick interrupt.
+*/
+static OS_TICK
+tickless_unstretch (void)
+{
+    uint16_t count;
+
+    CMT.CMSTR0.BIT.STR0 = 0;
+
+    count = CMT0.CMCNT;
+    CMT0.CMCR.WORD = g_cmcr;
+    CMT0.CMCNT = (count % g_per_tick_slow) * g_ratio;
+    CMT0.CMCOR = g_per_tick - 1;
+
+    gb_stretched = 0;
+
+    CMT.CMSTR0.BIT.STR0 = 1;
+
+    return count / g_per_tick_slow;
+}
+
+/*!
+* @brief Sleep until the next kernel deadline or any interrupt.
+* @note  Called from the idle task hook, over and over.
+*/
+void
+tickless_idle (void)
+{
+    OS_ERR   err;
+    OS_TICK  n_ticks;
+    OS_TICK  missed;
+    uint64_t start_us;
+#if OS_CFG_SCHED_LOCK_TIME_MEAS_EN > 0u
+    CPU_SR_ALLOC();
+#endif
+
+
+    if (!gb_ready)
+    {
+        idle_wait();
+        return;
+    }
+
+    OSSchedLock(&err);
+    assert(OS_ERR_NONE == err);
+
+    __disable_interrupt();
+
+    n_ticks = tickless_next_deadline();
+    if (n_ticks > g_max_ticks)
+    {
+        n_ticks = g_max_ticks;
+    }
+
+    if (n_ticks < 2)
+    {
+        // Nothing to gain; sleep until the next tick as usual.
+        __enable_interrupt();
+        OSSchedUnlock(&err);
+        idle_wait();
+        return;
+    }
+
+    tickless_stretch(n_ticks);
+    start_us = sysclock_us();
+
+    idle_wait();
+    __disable_interrupt();
+
+    if (!gb_stretched)
+    {
+        // Slept the full n_ticks; the tick interrupt delivered the last one.
+        missed = n_ticks - 1;
+    }
+    else if (*p_IR_cmi0)
+    {
+        // The deadline arrived just after the wake-up. Its interrupt is
+        // still pending and will deliver the last tick.
+        (void)tickless_unstretch();
+        missed = n_ticks - 1;
+    }
+    else
+    {
+        // Woken early by some other interrupt.
+        missed = tickless_unstretch();
+    }
+
+    __enable_interrupt();
+
+    gb_announcing = 1;
+    for (OS_TICK i = 0; i < missed; i++)
+    {
+        OSTimeTick();
+    }
+    gb_announcing = 0;
+
+    g_stats.sleeps++;
+    g_stats.suppressed += missed;
+    g_stats.sleep_us   += sysclock_us() - start_us;
+
+#if OS_CFG_SCHED_LOCK_TIME_MEAS_EN > 0u
+    // The sleep holds the scheduler lock far longer than any real critical
+    // section. Restart the kernel's lock timer so that only the few
+    // instructions to the unlock are measured.
+    CPU_CRITICAL_ENTER();
+    OSSchedLockTimeBegin = OS_TS_GET();
+    CPU_CRITICAL_EXIT();
+#endif
+
+    OSSchedUnlock(&err);
+    assert(OS_ERR_NONE == err);
+}
+
+/*!
+* @brief Restore the normal tick as soon as a stretched sleep expires.
+* @note  Called from App_OS_TimeTickHook().
+*/
+void
+tickless_tick_hook (void)
+{
+    if (gb_stretched && !gb_announcing)
+    {
+        (void)tickless_unstretch();
+    }
+}
+
+/*!
+* @brief Copy out the tick suppression counters.
+* @param[out] p_stats Where to put them.
+*/
+void
+tickless_stats_get (tickless_stats_t * p_stats)
+{
+    OS_ERR err;
+
+    OSSchedLock(&err);
+    assert(OS_ERR_NONE == err);
+
+    *p_stats = g_stats;
+
+    OSSchedUnlock(&err);
+    assert(OS_ERR_NONE == err);
+}
+
+/*!
+* @brief Average length of a stretched-tick sleep.
+* @return Microseconds, or 0 before the first sleep.
+*/
+uint32_t
+tickless_avg_sleep_us (void)
+{
+    tickless_stats_t stats;
+
+    tickless_stats_get(&stats);
+
+    return (0 == stats.sleeps) ? 0 : (uint32_t)(stats.sleep_us / stats.sleeps);
+}
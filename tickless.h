@@ -0,0 +1,31 @@
+/** \file tickless.h
+*
+* @brief Tick suppression while the CPU is idle.
+*
+* @par
+* COPYRIGHT NOTICE: (C) 2014 Barr Group, LLC.
+* All rights reserved.
+*/
+
+#ifndef _TICKLESS_H
+#define _TICKLESS_H
+
+#include <stdint.h>
+
+// Set to 0 to keep the 1 kHz tick running through idle periods.
+#define TICKLESS_EN     1
+
+typedef struct
+{
+    uint32_t  sleeps;           // Stretched-tick sleeps taken.
+    uint32_t  suppressed;       // Ticks announced without a tick interrupt.
+    uint64_t  sleep_us;         // Total time spent in those sleeps.
+} tickless_stats_t;
+
+void     tickless_init(void);
+void     tickless_idle(void);
+void     tickless_tick_hook(void);
+void     tickless_stats_get(tickless_stats_t * p_stats);
+uint32_t tickless_avg_sleep_us(void);
+
+#endif /* _TICKLESS_H */
@@ -0,0 +1,156 @@
+#!/usr/bin/env python3
+"""Decode a raw dump of g_trace (see trace.h) into Chrome trace JSON.
+
+Halt the target, save the memory of g_trace as a raw binary file from the
+debugger, then:
+
+    python3 tools/trace_decode.py g_trace.bin -o trace.json
+
+and load trace.json in chrome://tracing or https://ui.perfetto.dev.
+"""
+
+import argparse
+import json
+import struct
+import sys
+
+TRACE_MAGIC = 0x31435254
+
+# Must agree with trace_event_t in trace.h.
+EV_NONE, EV_SWITCH, EV_ISR_ENTER, EV_ISR_EXIT, EV_SEM_POST, EV_SEM_PEND, \
+    EV_FLAG_POST, EV_FLAG_PEND, EV_Q_POST, EV_Q_PEND, EV_MARK = range(11)
+
+# Must agree with trace_err_t in trace.h.
+ERR_NAMES = {
+    0: "none",
+    1: "timeout",
+    2: "queue full",
+    3: "message pool empty",
+    4: "pend aborted",
+    5: "object deleted",
+    0xFF: "other",
+}
+
+# Events whose arg8 is a trace_err_t.
+ERR_EVENTS = (EV_SEM_PEND, EV_Q_POST, EV_Q_PEND)
+
+EVENT_NAMES = {
+    EV_SEM_POST: "SemPost",
+    EV_SEM_PEND: "SemPend",
+    EV_FLAG_POST: "FlagPost",
+    EV_FLAG_PEND: "FlagPend",
+    EV_Q_POST: "QPost",
+    EV_Q_PEND: "QPend",
+    EV_MARK: "Mark",
+}
+
+# Task priorities from divecomputer.c and os_cfg_app.h.
+DEFAULT_TASKS = {
+    1: "Startup / Tick",
+    6: "Alarms / Timers",
+    7: "Button Debouncer",
+    10: "Dive Calculations",
+    11: "Speaker",
+    12: "Display",
+    15: "Idle",
+}
+
+ISR_TID = 100
+
+
+def read_records(data):
+    """Return the records in the order they were written."""
+    magic, head = struct.unpack_from("<II", data, 0)
+    if magic != TRACE_MAGIC:
+        sys.exit("not a trace dump (magic 0x%08X)" % magic)
+
+    n_slots = (len(data) - 8) // 8
+    count = min(head, n_slots)
+    first = head - count
+
+    records = []
+    for i in range(first, head):
+        offset = 8 + (i % n_slots) * 8
+        records.append(struct.unpack_from("<IBBH", data, offset))
+    return records
+
+
+def unwrap(records):
+    """Extend the 32-bit microsecond stamps and sort by time."""
+    out = []
+    base = 0
+    last = None
+    for time_us, event, arg8, arg16 in records:
+        if last is not None and time_us < last and (last - time_us) > 0x80000000:
+            base += 1 << 32
+        last = time_us
+        out.append((base + time_us, event, arg8, arg16))
+    out.sort(key=lambda r: r[0])
+    return out
+
+
+def to_chrome(records, tasks):
+    events = []
+    for prio, name in tasks.items():
+        events.append({"ph": "M", "pid": 1, "tid": prio, "name": "thread_name",
+                       "args": {"name": "%s (%d)" % (name, prio)}})
+    events.append({"ph": "M", "pid": 1, "tid": ISR_TID, "name": "thread_name",
+                   "args": {"name": "Interrupts"}})
+
+    running = None
+    started = None
+    isr_depth = 0
+    for time_us, event, arg8, arg16 in records:
+        if event == EV_SWITCH:
+            if running is not None:
+                events.append({"ph": "X", "pid": 1, "tid": running,
+                               "name": tasks.get(running, "prio %d" % running),
+                               "ts": started, "dur": time_us - started})
+            running, started = arg8, time_us
+        elif event in (EV_ISR_ENTER, EV_ISR_EXIT):
+            isr_depth += 1 if event == EV_ISR_ENTER else -1
+            isr_depth = max(isr_depth, 0)
+            events.append({"ph": "B" if event == EV_ISR_ENTER else "E",
+                           "pid": 1, "tid": ISR_TID,
+                           "name": "vector %d" % arg8, "ts": time_us})
+        elif event in EVENT_NAMES:
+            if event == EV_MARK:
+                args = {"id": arg8, "value": arg16}
+            elif event in ERR_EVENTS:
+                args = {"object": "0x%04X" % arg16,
+                        "error": ERR_NAMES.get(arg8, "code %d" % arg8)}
+            else:
+                args = {"object": "0x%04X" % arg16, "arg": arg8}
+            events.append({"ph": "i", "s": "t", "pid": 1,
+                           "tid": running if (running is not None and not isr_depth) else ISR_TID,
+                           "name": EVENT_NAMES[event], "ts": time_us,
+                           "args": args})
+
+    return {"traceEvents": events, "displayTimeUnit": "ms"}
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("dump", help="raw binary dump of g_trace")
+    parser.add_argument("-o", "--output", help="JSON file (default: stdout)")
+    parser.add_argument("--task", action="append", default=[], metavar="PRIO=NAME",
+                        help="name a task priority; may be repeated")
+    args = parser.parse_args()
+
+    tasks = dict(DEFAULT_TASKS)
+    for item in args.task:
+        prio, name = item.split("=", 1)
+        tasks[int(prio)] = name
+
+    with open(args.dump, "rb") as f:
+        records = unwrap(read_records(f.read()))
+
+    out = open(args.output, "w") if args.output else sys.stdout
+    json.dump(to_chrome(records, tasks), out, indent=1)
+    if args.output:
+        out.close()
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,94 @@
+/** \file trace.c
+*
+* @brief Binary event trace recorder.
+*
+* Fixed-size records go into a RAM ring that overwrites its oldest entries.
+* Recording takes no kernel lock, so it is safe from the OS hooks and from
+* interrupt handlers of any priority. Halt the target, save g_trace as raw
+* binary from the debugger, and turn it into a timeline with
+* tools/trace_decode.py.
+*
+* @par
+* COPYRIGHT NOTICE: (C) 2014 Barr Group, LLC.
+* All rights reserved.
+*/
+
+#include <stdint.h>
+#include <string.h>
+
+#include <intrinsics.h>
+
+#include "os.h"
+
+#include "sysclock.h"
+#include "trace.h"
+
+
+trace_buf_t  g_trace = { TRACE_MAGIC };
+
+
+/*!
+* @brief Append one record to the trace ring.
+* @param[in] event One of trace_event_t.
+* @param[in] arg8  Event-specific.
+* @param[in] arg16 Event-specific.
+*/
+void
+trace_record (uint8_t event, uint8_t arg8, uint16_t arg16)
+{
+    uint32_t       time_us = (uint32_t)sysclock_us();
+    uint32_t       head;
+    __istate_t     istate;
+    trace_rec_t  * p_rec;
+
+
+    // The RX has no compare-and-swap, so claiming a slot masks interrupts
+    // for the two instructions of the increment. The record itself is
+    // filled in with interrupts on; nothing else can have claimed it.
+    istate = __get_interrupt_state();
+    __disable_interrupt();
+    head = g_trace.head++;
+    __set_interrupt_state(istate);
+
+    p_rec = &g_trace.rec[head & (TRACE_RECORDS - 1)];
+    p_rec->time_us = time_us;
+    p_rec->event   = event;
+    p_rec->arg8    = arg8;
+    p_rec->arg16   = arg16;
+}
+
+/*!
+* @brief Map a uC/OS-III error code to one of trace_err_t.
+* @param[in] os_err An OS_ERR.
+* @return The code, which fits in a record's arg8.
+*/
+uint8_t
+trace_err (uint32_t os_err)
+{
+    switch (os_err)
+    {
+    case OS_ERR_NONE:               return TRACE_ERR_NONE;
+    case OS_ERR_TIMEOUT:            return TRACE_ERR_TIMEOUT;
+    case OS_ERR_Q_MAX:              return TRACE_ERR_Q_MAX;
+    case OS_ERR_MSG_POOL_EMPTY:     return TRACE_ERR_MSG_POOL_EMPTY;
+    case OS_ERR_PEND_ABORT:         return TRACE_ERR_PEND_ABORT;
+    case OS_ERR_OBJ_DEL:            return TRACE_ERR_OBJ_DEL;
+    default:                        return TRACE_ERR_OTHER;
+    }
+}
+
+/*!
+* @brief Throw away everything recorded so far.
+*/
+void
+trace_clear (void)
+{
+    __istate_t istate;
+
+
+    istate = __get_interrupt_state();
+    __disable_interrupt();
+    g_trace.head = 0;
+    memset(g_trace.rec, 0, sizeof(g_trace.rec));
+    __set_interrupt_state(istate);
+}
@@ -0,0 +1,103 @@
+/** \file trace.h
+*
+* @brief Binary event trace recorder.
+*
+* @par
+* COPYRIGHT NOTICE: (C) 2014 Barr Group, LLC.
+* All rights reserved.
+*/
+
+#ifndef _TRACE_H
+#define _TRACE_H
+
+#include <stdint.h>
+
+// Set to 0 to compile every TRACE_xxx() call site away.
+#define TRACE_EN            1
+
+#define TRACE_RECORDS       512     // Must be a power of two; 8 bytes each.
+#define TRACE_MAGIC         0x31435254uL    // "TRC1", little endian.
+
+// Record types. tools/trace_decode.py must agree.
+typedef enum
+{
+    TRACE_EV_NONE,
+    TRACE_EV_SWITCH,        // arg8: new priority,  arg16: old priority
+    TRACE_EV_ISR_ENTER,     // arg8: vector
+    TRACE_EV_ISR_EXIT,      // arg8: vector
+    TRACE_EV_SEM_POST,      // arg16: object
+    TRACE_EV_SEM_PEND,      // arg8: trace_err_t,   arg16: object
+    TRACE_EV_FLAG_POST,     // arg8: flags,         arg16: object
+    TRACE_EV_FLAG_PEND,     // arg8: flags,         arg16: object
+    TRACE_EV_Q_POST,        // arg8: trace_err_t,   arg16: object
+    TRACE_EV_Q_PEND,        // arg8: trace_err_t,   arg16: object
+    TRACE_EV_MARK,          // arg8: marker id,     arg16: value
+} trace_event_t;
+
+// The error of a pend or post, squeezed into arg8. uC/OS-III error codes are
+// five-digit numbers, so only the ones expected here get a code of their own.
+// tools/trace_decode.py must agree.
+typedef enum
+{
+    TRACE_ERR_NONE,
+    TRACE_ERR_TIMEOUT,
+    TRACE_ERR_Q_MAX,
+    TRACE_ERR_MSG_POOL_EMPTY,
+    TRACE_ERR_PEND_ABORT,
+    TRACE_ERR_OBJ_DEL,
+    TRACE_ERR_OTHER = 0xFF
+} trace_err_t;
+
+typedef struct
+{
+    uint32_t  time_us;      // Low half of sysclock_us().
+    uint8_t   event;
+    uint8_t   arg8;
+    uint16_t  arg16;
+} trace_rec_t;
+
+// The whole recorder, laid out so a raw dump of it decodes on its own.
+typedef struct
+{
+    uint32_t     magic;
+    uint32_t     head;      // Records ever written; the next goes at head % TRACE_RECORDS.
+    trace_rec_t  rec[TRACE_RECORDS];
+} trace_buf_t;
+
+extern trace_buf_t  g_trace;
+
+void    trace_record(uint8_t event, uint8_t arg8, uint16_t arg16);
+void    trace_clear(void);
+uint8_t trace_err(uint32_t os_err);
+
+#if TRACE_EN > 0
+
+#define TRACE_OBJ(p_obj)                ((uint16_t)(uintptr_t)(p_obj))
+
+#define TRACE_SWITCH(from, to)          trace_record(TRACE_EV_SWITCH, (to), (from))
+#define TRACE_ISR_ENTER(vect)           trace_record(TRACE_EV_ISR_ENTER, (vect), 0)
+#define TRACE_ISR_EXIT(vect)            trace_record(TRACE_EV_ISR_EXIT, (vect), 0)
+#define TRACE_SEM_POST(p_sem)           trace_record(TRACE_EV_SEM_POST, 0, TRACE_OBJ(p_sem))
+#define TRACE_SEM_PEND(p_sem, err)      trace_record(TRACE_EV_SEM_PEND, trace_err(err), TRACE_OBJ(p_sem))
+#define TRACE_FLAG_POST(p_grp, flags)   trace_record(TRACE_EV_FLAG_POST, (uint8_t)(flags), TRACE_OBJ(p_grp))
+#define TRACE_FLAG_PEND(p_grp, flags)   trace_record(TRACE_EV_FLAG_PEND, (uint8_t)(flags), TRACE_OBJ(p_grp))
+#define TRACE_Q_POST(p_q, err)          trace_record(TRACE_EV_Q_POST, trace_err(err), TRACE_OBJ(p_q))
+#define TRACE_Q_PEND(p_q, err)          trace_record(TRACE_EV_Q_PEND, trace_err(err), TRACE_OBJ(p_q))
+#define TRACE_MARK(id, value)           trace_record(TRACE_EV_MARK, (id), (value))
+
+#else
+
+#define TRACE_SWITCH(from, to)
+#define TRACE_ISR_ENTER(vect)
+#define TRACE_ISR_EXIT(vect)
+#define TRACE_SEM_POST(p_sem)
+#define TRACE_SEM_PEND(p_sem, err)
+#define TRACE_FLAG_POST(p_grp, flags)
+#define TRACE_FLAG_PEND(p_grp, flags)
+#define TRACE_Q_POST(p_q, err)
+#define TRACE_Q_PEND(p_q, err)
+#define TRACE_MARK(id, value)
+
+#endif /* TRACE_EN */
+
+#endif /* _TRACE_H */
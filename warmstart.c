@@ -0,0 +1,190 @@
+/** \file warmstart.c
+*
+* @brief Dive state kept over a reset.
+*
+* The calculator saves the live dive state every frame into RAM that the
+* C start-up code leaves alone. After a watchdog or assert reset the state
+* is still there, and start-up can carry on with the dive instead of
+* beginning a new one. After power-up the RAM holds noise, which the
+* magic word and CRC turn away.
+*
+* Only resets the diver did not ask for are resumed: the independent or
+* regular watchdog (a failed assert ends in one) and a software reset. The
+* reset button, a debugger reset and power-up start a new dive. A state
+* that itself causes the reset would otherwise be resumed forever, so
+* after WARMSTART_MAX_RESUMES warm starts in a row without a settled run
+* in between, the next one starts cold.
+*
+* Saves alternate between two slots, so a reset in the middle of a save
+* still leaves the previous one intact.
+*
+* @par
+* COPYRIGHT NOTICE: (C) 2014 Barr Group, LLC.
+* All rights reserved.
+*/
+
+#include <stdint.h>
+
+#include "iorx63n.h"
+
+#include "warmstart.h"
+
+
+#define WARMSTART_MAGIC     0x4D524157uL    // "WARM"
+
+typedef struct
+{
+    uint32_t      magic;
+    uint32_t      seq;          // Higher is newer.
+    uint8_t       resumes;      // Warm starts in a row up to this save.
+    warm_state_t  state;
+    uint32_t      crc;          // Over all of the above.
+} warm_slot_t;
+
+static __no_init warm_slot_t  g_slots[2];
+
+static uint32_t  g_seq;
+static uint8_t   g_next;        // Slot the next save goes to.
+static uint8_t   g_resumes;
+static uint16_t  g_saves;       // Since start-up, up to WARMSTART_SETTLE_SAVES.
+
+
+/*!
+* @brief CRC-32 (IEEE 802.3) of a block of memory.
+*/
+static uint32_t
+warmstart_crc (void const * p_data, uint32_t len)
+{
+    uint8_t const * p_byte = (uint8_t const *)p_data;
+    uint32_t        crc = 0xFFFFFFFFuL;
+
+
+    while (len--)
+    {
+        crc ^= *p_byte++;
+        for (uint8_t bit = 0; bit < 8; bit++)
+        {
+            crc = (crc >> 1) ^ (0xEDB88320uL & (0u - (crc & 1u)));
+        }
+    }
+
+    return ~crc;
+}
+
+/*!
+* @brief Whether a slot holds a whole, uncorrupted save.
+*/
+static uint8_t
+warmstart_valid (warm_slot_t const * p_slot)
+{
+    return (WARMSTART_MAGIC == p_slot->magic) &&
+           (warmstart_crc(p_slot, sizeof(*p_slot) - sizeof(p_slot->crc)) == p_slot->crc);
+}
+
+/*!
+* @brief Save the live dive state.
+* @param[in] p_state The state.
+* @note  Only calculator_task may call this.
+*/
+void
+warmstart_save (warm_state_t const * p_state)
+{
+    warm_slot_t * p_slot = &g_slots[g_next];
+
+
+    // Spoil the magic first, so a half-written slot never looks valid.
+    p_slot->magic   = 0;
+    p_slot->seq     = ++g_seq;
+    p_slot->resumes = g_resumes;
+    p_slot->state   = *p_state;
+    p_slot->magic = WARMSTART_MAGIC;
+    p_slot->crc   = warmstart_crc(p_slot, sizeof(*p_slot) - sizeof(p_slot->crc));
+
+    g_next ^= 1;
+
+    // Running this long after a warm start means the state was sound.
+    if ((g_resumes > 0) && (++g_saves >= WARMSTART_SETTLE_SAVES))
+    {
+        g_resumes = 0;
+    }
+}
+
+/*!
+* @brief Whether the last reset came from a watchdog or software reset.
+* @note  The flags survive a pin reset, so they are cleared once read.
+*/
+static uint8_t
+warmstart_unplanned_reset (void)
+{
+    uint8_t b_unplanned = SYSTEM.RSTSR2.BIT.IWDTRF ||
+                          SYSTEM.RSTSR2.BIT.WDTRF  ||
+                          SYSTEM.RSTSR2.BIT.SWRF;
+
+
+    SYSTEM.RSTSR2.BIT.IWDTRF = 0;
+    SYSTEM.RSTSR2.BIT.WDTRF  = 0;
+    SYSTEM.RSTSR2.BIT.SWRF   = 0;
+
+    return b_unplanned;
+}
+
+/*!
+* @brief Forget both saves, so that nothing later resumes them.
+*/
+static void
+warmstart_discard (void)
+{
+    g_slots[0].magic = 0;
+    g_slots[1].magic = 0;
+
+    g_seq     = 0;
+    g_next    = 0;
+    g_resumes = 0;
+}
+
+/*!
+* @brief Recover the state saved before the reset, if there is one.
+* @param[out] p_state Where to put it.
+* @return 1 if the state was recovered, 0 for a cold start.
+* @note  Call once, at start-up, before calculator_task runs.
+*/
+uint8_t
+warmstart_load (warm_state_t * p_state)
+{
+    uint8_t b_unplanned = warmstart_unplanned_reset();
+    uint8_t b_valid0    = warmstart_valid(&g_slots[0]);
+    uint8_t b_valid1    = warmstart_valid(&g_slots[1]);
+    uint8_t newest;
+
+
+    if (!b_unplanned || (!b_valid0 && !b_valid1))
+    {
+        warmstart_discard();
+        return 0;
+    }
+
+    if (b_valid0 && b_valid1)
+    {
+        newest = ((int32_t)(g_slots[1].seq - g_slots[0].seq) > 0) ? 1 : 0;
+    }
+    else
+    {
+        newest = b_valid1 ? 1 : 0;
+    }
+
+    if (g_slots[newest].resumes >= WARMSTART_MAX_RESUMES)
+    {
+        // Resuming this state has not stuck; give up on the dive.
+        warmstart_discard();
+        return 0;
+    }
+
+    *p_state = g_slots[newest].state;
+
+    // Carry on the sequence, overwriting the older slot first.
+    g_seq     = g_slots[newest].seq;
+    g_next    = newest ^ 1;
+    g_resumes = g_slots[newest].resumes + 1;
+
+    return 1;
+}
@@ -0,0 +1,35 @@
+/** \file warmstart.h
+*
+* @brief Dive state kept over a reset.
+*
+* @par
+* COPYRIGHT NOTICE: (C) 2014 Barr Group, LLC.
+* All rights reserved.
+*/
+
+#ifndef _WARMSTART_H
+#define _WARMSTART_H
+
+#include <stdint.h>
+
+#include "calculator.h"
+
+// Warm starts in a row, without a settled run between, before a cold one.
+#define WARMSTART_MAX_RESUMES   3
+
+// Saves after a warm start that count as a settled run (about a minute at
+// the calculator's 100 ms checkpoint).
+#define WARMSTART_SETTLE_SAVES  600
+
+typedef struct
+{
+    CalculationState  calc;
+    uint32_t          dive_ms;          // Dive timer reading.
+    uint8_t           b_timer_running;
+    uint8_t           b_new_timer;      // No dive started yet.
+} warm_state_t;
+
+void    warmstart_save(warm_state_t const * p_state);
+uint8_t warmstart_load(warm_state_t * p_state);
+
+#endif /* _WARMSTART_H */
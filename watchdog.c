@@ -0,0 +1,281 @@
+/** \file watchdog.c
+*
+* @brief Task heartbeat supervisor and hardware watchdog.
+*
+* Each supervised task registers with the longest gap it may leave between
+* heartbeats, then calls watchdog_beat() once per pass of its loop. That
+* only stores the tick count. An OS timer callback checks every task at
+* 10 Hz and refreshes the independent watchdog (IWDT) only if all of them
+* are on time. Otherwise it records the task silent longest in RAM that
+* is not initialized at start-up, and lets the IWDT reset the chip about
+* half a second later.
+*
+* The check runs in the timer task, so a task that starves the timer task
+* of CPU stops the refresh too.
+*
+* @par
+* COPYRIGHT NOTICE: (C) 2014 Barr Group, LLC.
+* All rights reserved.
+*/
+
+#include <assert.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "cpu.h"
+#include "os.h"
+#include "iorx63n.h"
+
+#include "watchdog.h"
+
+
+// IWDTCLK (125 kHz) / 16, 4096 cycles to time out: about 524 ms. The
+// refresh window is left fully open.
+#define IWDTCR_SETTING      0x3321u
+#define IWDTRCR_RESET       0x80u       // Reset on time-out; no interrupt.
+
+#define WATCHDOG_MAGIC      0x57444F47uL    // "WDOG"
+
+#define MS_TO_TICKS(ms)     (((OS_TICK)(ms) * OS_CFG_TICK_RATE_HZ) / 1000u)
+#define TICKS_TO_MS(ticks)  (((uint32_t)(ticks) * 1000u) / OS_CFG_TICK_RATE_HZ)
+
+typedef struct
+{
+    char const *      p_name;
+    OS_TICK           max_gap;
+    OS_TICK volatile  last_beat;
+    uint32_t          worst_gap_ms;
+    uint32_t          misses;
+} watchdog_client_t;
+
+static watchdog_client_t  g_clients[WATCHDOG_MAX_TASKS];
+static uint8_t            g_n_clients;
+
+static uint8_t            gb_tripped;
+
+// Survives a watchdog reset; checked against the magic word.
+static __no_init watchdog_trip_t  g_trip;
+static watchdog_trip_t            g_last_trip;
+
+static OS_TMR             g_watchdog_timer;
+
+
+/*!
+* @brief Refresh the IWDT. The first refresh also starts it.
+*/
+static void
+watchdog_refresh (void)
+{
+#if WATCHDOG_IWDT_EN > 0
+    IWDT.IWDTRR = 0x00;
+    IWDT.IWDTRR = 0xFF;
+#endif
+}
+
+/*!
+* @brief Check every heartbeat, and refresh the IWDT if all are on time.
+* @note  OS timer callback, run every WATCHDOG_CHECK_MS.
+*/
+static void
+watchdog_check (void * p_tmr, void * p_arg)
+{
+    OS_ERR   err;
+    OS_TICK  now;
+    OS_TICK  gap;
+    OS_TICK  late_gap = 0;
+    int8_t   late = -1;
+
+
+    (void)p_tmr;
+    (void)p_arg;
+
+    now = OSTimeGet(&err);
+
+    for (uint8_t i = 0; i < g_n_clients; i++)
+    {
+        watchdog_client_t * p_client = &g_clients[i];
+
+        gap = now - p_client->last_beat;
+        if (TICKS_TO_MS(gap) > p_client->worst_gap_ms)
+        {
+            p_client->worst_gap_ms = TICKS_TO_MS(gap);
+        }
+
+        if (gap > p_client->max_gap)
+        {
+            p_client->misses++;
+
+            // Blame the one silent longest; the rest may only be waiting on it.
+            if (gap > late_gap)
+            {
+                late     = (int8_t)i;
+                late_gap = gap;
+            }
+        }
+    }
+
+    if (gb_tripped)
+    {
+        // Stay tripped until the reset.
+    }
+    else if (late < 0)
+    {
+        watchdog_refresh();
+    }
+    else
+    {
+        g_trip.magic  = WATCHDOG_MAGIC;
+        g_trip.trips++;
+        g_trip.gap_ms = TICKS_TO_MS(late_gap);
+        strncpy(g_trip.name, g_clients[late].p_name, WATCHDOG_NAME_LEN - 1);
+        g_trip.name[WATCHDOG_NAME_LEN - 1] = '\0';
+
+        gb_tripped = 1;
+    }
+}
+
+/*!
+* @brief Start the IWDT and the supervisor.
+* @note  Call from start-up code, before the supervised tasks are created.
+*/
+void
+watchdog_init (void)
+{
+    OS_ERR err;
+
+
+    // Keep what the previous run left, then start afresh.
+    if (WATCHDOG_MAGIC == g_trip.magic)
+    {
+        g_last_trip = g_trip;
+    }
+    else
+    {
+        g_trip.trips = 0;
+    }
+    g_trip.magic = 0;
+
+#if WATCHDOG_IWDT_EN > 0
+    // IWDTCLK comes from the IWDT's own low-speed oscillator, which is
+    // stopped after reset. Without it the counter never runs down.
+    /* Protection off */
+    SYSTEM.PRCR.WORD = 0xA503u;
+
+    SYSTEM.ILOCOCR.BIT.ILCSTP = 0;
+
+    /* Protection on */
+    SYSTEM.PRCR.WORD = 0xA500u;
+
+    // These may be written once only, before the first refresh.
+    IWDT.IWDTCR.WORD  = IWDTCR_SETTING;
+    IWDT.IWDTRCR.BYTE = IWDTRCR_RESET;
+#endif
+    watchdog_refresh();
+
+    OSTmrCreate(&g_watchdog_timer,
+                "Watchdog",
+                0,
+                (WATCHDOG_CHECK_MS * OS_CFG_TMR_TASK_RATE_HZ) / 1000u,
+                OS_OPT_TMR_PERIODIC,
+                watchdog_check,
+                NULL,
+                &err);
+    assert(OS_ERR_NONE == err);
+
+    OSTmrStart(&g_watchdog_timer, &err);
+    assert(OS_ERR_NONE == err);
+}
+
+/*!
+* @brief Put the calling task under supervision.
+* @param[in] p_name     For the trip record.
+* @param[in] max_gap_ms Longest allowed between heartbeats.
+* @return Id to pass to watchdog_beat().
+*/
+uint8_t
+watchdog_register (char const * p_name, uint16_t max_gap_ms)
+{
+    OS_ERR   err;
+    uint8_t  id;
+    CPU_SR_ALLOC();
+
+
+    // Anything shorter than two checks would trip on check jitter alone.
+    assert(max_gap_ms >= 2 * WATCHDOG_CHECK_MS);
+
+    CPU_CRITICAL_ENTER();
+
+    assert(g_n_clients < WATCHDOG_MAX_TASKS);
+    id = g_n_clients;
+
+    g_clients[id].p_name       = p_name;
+    g_clients[id].max_gap      = MS_TO_TICKS(max_gap_ms);
+    g_clients[id].last_beat    = OSTimeGet(&err);
+    g_clients[id].worst_gap_ms = 0;
+    g_clients[id].misses       = 0;
+
+    // Counted last, so the supervisor never sees a half-made entry.
+    g_n_clients++;
+
+    CPU_CRITICAL_EXIT();
+
+    return id;
+}
+
+/*!
+* @brief Report that a supervised task is still making progress.
+* @param[in] id From watchdog_register().
+*/
+void
+watchdog_beat (uint8_t id)
+{
+    OS_ERR err;
+
+    g_clients[id].last_beat = OSTimeGet(&err);
+}
+
+/*!
+* @brief Copy out the heartbeat figures.
+* @param[out] p_entries Array to fill.
+* @param[in]  max       Entries in it.
+* @return Entries filled.
+*/
+uint8_t
+watchdog_report (watchdog_entry_t * p_entries, uint8_t max)
+{
+    uint8_t n = 0;
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+
+    for (; (n < g_n_clients) && (n < max); n++)
+    {
+        p_entries[n].p_name       = g_clients[n].p_name;
+        p_entries[n].max_gap_ms   = (uint16_t)TICKS_TO_MS(g_clients[n].max_gap);
+        p_entries[n].worst_gap_ms = g_clients[n].worst_gap_ms;
+        p_entries[n].misses       = g_clients[n].misses;
+    }
+
+    CPU_CRITICAL_EXIT();
+
+    return n;
+}
+
+/*!
+* @brief Which task, if any, caused the reset before this run.
+* @param[out] p_trip Where to put the record.
+* @return 1 if the last reset was the supervisor's doing.
+*/
+uint8_t
+watchdog_last_trip (watchdog_trip_t * p_trip)
+{
+    if (WATCHDOG_MAGIC != g_last_trip.magic)
+    {
+        return 0;
+    }
+
+    *p_trip = g_last_trip;
+
+    return 1;
+}
@@ -0,0 +1,45 @@
+/** \file watchdog.h
+*
+* @brief Task heartbeat supervisor and hardware watchdog.
+*
+* @par
+* COPYRIGHT NOTICE: (C) 2014 Barr Group, LLC.
+* All rights reserved.
+*/
+
+#ifndef _WATCHDOG_H
+#define _WATCHDOG_H
+
+#include <stdint.h>
+
+// Set to 0 to supervise without starting the IWDT, e.g. when debugging.
+#define WATCHDOG_IWDT_EN        1
+
+#define WATCHDOG_CHECK_MS       100u    // The supervisor runs at 10 Hz.
+#define WATCHDOG_MAX_TASKS      8
+#define WATCHDOG_NAME_LEN       16
+
+typedef struct
+{
+    char const *  p_name;
+    uint16_t      max_gap_ms;   // Longest allowed between heartbeats.
+    uint32_t      worst_gap_ms;
+    uint32_t      misses;
+} watchdog_entry_t;
+
+// The task that missed its deadline, kept over the reset that follows.
+typedef struct
+{
+    uint32_t  magic;
+    uint32_t  trips;            // Since power-on.
+    uint32_t  gap_ms;
+    char      name[WATCHDOG_NAME_LEN];
+} watchdog_trip_t;
+
+void    watchdog_init(void);
+uint8_t watchdog_register(char const * p_name, uint16_t max_gap_ms);
+void    watchdog_beat(uint8_t id);
+uint8_t watchdog_report(watchdog_entry_t * p_entries, uint8_t max);
+uint8_t watchdog_last_trip(watchdog_trip_t * p_trip);
+
+#endif /* _WATCHDOG_H */